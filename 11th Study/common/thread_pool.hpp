@@ -0,0 +1,99 @@
+//
+//  thread_pool.hpp
+//  cpptemples-ch19
+//
+
+#ifndef thread_pool_h
+#define thread_pool_h
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// fixed set of worker threads; parallel_for() lets the calling thread join in
+class thread_pool {
+public:
+    explicit thread_pool(unsigned workers) {
+        for (unsigned i = 0; i < workers; ++i) {
+            threads.emplace_back([this] { work(); });
+        }
+    }
+    thread_pool(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_all();
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    // threads that take part in parallel_for (workers plus caller)
+    unsigned concurrency() const {
+        return static_cast<unsigned>(threads.size()) + 1;
+    }
+
+    // calls f(i) for every i in [0, n) and returns when all calls are done;
+    // f must not throw, and must not call parallel_for of the same pool
+    template <typename F>
+    void parallel_for(std::size_t n, F const& f) {
+        std::atomic<std::size_t> next{0};
+        auto run = [&] {
+            for (std::size_t i; (i = next.fetch_add(1)) < n; ) {
+                f(i);
+            }
+        };
+        std::size_t helpers = std::min(threads.size(), n > 0 ? n - 1 : 0);
+        std::latch done(static_cast<std::ptrdiff_t>(helpers));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (std::size_t i = 0; i < helpers; ++i) {
+                tasks.emplace_back([&] { run(); done.count_down(); });
+            }
+        }
+        wakeup.notify_all();
+        run();
+        done.wait();
+    }
+
+    // pool shared by the whole program, one thread per hardware thread
+    static thread_pool& instance() {
+        static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        return pool;
+    }
+
+private:
+    void work() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeup.wait(lock, [this] { return stop || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::deque<std::function<void()>> tasks;
+    bool stop = false;
+};
+
+#endif /* thread_pool_h */
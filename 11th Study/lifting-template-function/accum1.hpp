@@ -9,23 +9,15 @@
 #ifndef accum1_h
 #define accum1_h
 
-template <typename>
-struct accum_traits;
-
-template <>
-struct accum_traits<char> {
-    using type = int;
-    static constexpr type identity() {
-        return 0;
-    }
-};
+#include <cstddef>
+#include <type_traits>
 
-template <typename T>
-auto accum(T const* beg, T const* end)
+#include "accum_traits.hpp"
+
+template <typename Acc, typename T>
+Acc accum_into(T const* beg, T const* end)
 {
-    using accum_type = typename accum_traits<T>::type;
-    
-    accum_type total = accum_traits<T>::identity();
+    Acc total = static_cast<Acc>(accum_traits<T>::identity());
     while (beg != end) {
         total = total + *beg;
         ++beg;
@@ -33,4 +25,43 @@ auto accum(T const* beg, T const* end)
     return total;
 }
 
+// whether n elements of T are summed in the narrow fast_type
+template <typename T>
+constexpr bool accum_uses_fast_type(std::size_t n)
+{
+    return !std::is_same_v<typename accum_traits<T>::type,
+                           typename accum_traits<T>::fast_type>
+           && n <= accum_traits<T>::max_fast_count;
+}
+
+// sums in the narrow fast_type when the length can't overflow it
+template <typename T>
+auto accum(T const* beg, T const* end)
+{
+    using accum_type = typename accum_traits<T>::type;
+    using fast_type = typename accum_traits<T>::fast_type;
+
+    if constexpr (!std::is_same_v<accum_type, fast_type>) {
+        if (accum_uses_fast_type<T>(static_cast<std::size_t>(end - beg))) {
+            return static_cast<accum_type>(accum_into<fast_type>(beg, end));
+        }
+    }
+    return accum_into<accum_type>(beg, end);
+}
+
+// for arrays the length is known, so the path is selected at compile time
+template <typename T, std::size_t N>
+auto accum(T const (&arr)[N])
+{
+    using accum_type = typename accum_traits<T>::type;
+    using fast_type = typename accum_traits<T>::fast_type;
+
+    if constexpr (accum_uses_fast_type<T>(N)) {
+        return static_cast<accum_type>(accum_into<fast_type>(arr, arr + N));
+    }
+    else {
+        return accum_into<accum_type>(arr, arr + N);
+    }
+}
+
 #endif /* accum1_h */
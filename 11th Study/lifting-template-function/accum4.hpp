@@ -0,0 +1,117 @@
+//
+//  accum4.hpp
+//  cpptemples-ch19
+//
+
+#ifndef accum4_h
+#define accum4_h
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "accum_policy.hpp"
+
+// strictly sequential accumulation, as in accum3.hpp
+template <typename Policy, typename Iter>
+auto accum_serial(Iter beg, Iter end)
+{
+    auto total = Policy::identity();
+    while (beg != end) {
+        total = Policy::accum(total, *beg);
+        ++beg;
+    }
+    return total;
+}
+
+// accumulation into Lanes independent partial results: lane i takes the
+// elements i, i + Lanes, i + 2 * Lanes, ...; the lanes don't depend on each
+// other, so the compiler can keep them in separate (SIMD) registers
+template <typename Policy, std::size_t Lanes = 16, typename T>
+auto accum_lanes(T const* beg, T const* end)
+{
+    using accum_type = typename Policy::accum_type;
+
+    accum_type lanes[Lanes];
+    for (auto& lane : lanes) {
+        lane = Policy::identity();
+    }
+    for (; static_cast<std::size_t>(end - beg) >= Lanes; beg += Lanes) {
+        for (std::size_t i = 0; i < Lanes; ++i) {
+            lanes[i] = Policy::accum(lanes[i], beg[i]);
+        }
+    }
+    accum_type total = Policy::identity();
+    for (auto const& lane : lanes) {
+        total = Policy::combine(total, lane);
+    }
+    return Policy::combine(total, accum_serial<Policy>(beg, end));
+}
+
+// sum in the narrow fast_type of accum_traits (e.g. int for char)
+template <typename T>
+struct fast_sum_policy {
+    using value_type = T;
+    using accum_type = typename accum_traits<T>::fast_type;
+    static constexpr accum_type identity() {
+        return 0;
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return total + value;
+    }
+};
+
+// sum_policy of narrow integers (char, short) accumulates in long long, so
+// 16 lanes hold only 16 values per 128 bytes; instead blocks short enough not
+// to overflow fast_type are summed serially in it (integer sums may be
+// reordered, so the compiler vectorizes that loop itself) and only the block
+// sums are widened, as accum1.hpp does
+template <typename T>
+auto accum_fast_blocks(T const* beg, T const* end)
+{
+    using accum_type = typename accum_traits<T>::type;
+    constexpr std::size_t block = accum_traits<T>::max_fast_count;
+
+    accum_type total = 0;
+    while (static_cast<std::size_t>(end - beg) > block) {
+        total += accum_serial<fast_sum_policy<T>>(beg, beg + block);
+        beg += block;
+    }
+    return total + accum_serial<fast_sum_policy<T>>(beg, end);
+}
+
+template <typename T>
+constexpr bool has_fast_sum_v
+    = !std::is_same_v<typename accum_traits<T>::type, typename accum_traits<T>::fast_type>;
+
+// uses the multi-lane version for contiguous ranges if the policy allows the
+// reordering (or the policy's own accum_range, if it has one), and the
+// sequential version otherwise
+template <typename Iter, template <typename> class Policy = sum_policy>
+auto accum(Iter beg, Iter end)
+{
+    using value_type = typename std::iterator_traits<Iter>::value_type;
+    using policy = Policy<value_type>;
+
+    if constexpr (std::contiguous_iterator<Iter>
+                  && is_associative_policy_v<policy>
+                  && is_commutative_policy_v<policy>) {
+        auto first = std::to_address(beg);
+        if constexpr (requires { policy::accum_range(first, first); }) {
+            return policy::accum_range(first, first + (end - beg));
+        }
+        else if constexpr (std::is_same_v<policy, sum_policy<value_type>>
+                           && has_fast_sum_v<value_type>) {
+            return accum_fast_blocks(first, first + (end - beg));
+        }
+        else {
+            return accum_lanes<policy>(first, first + (end - beg));
+        }
+    }
+    else {
+        return accum_serial<policy>(beg, end);
+    }
+}
+
+#endif /* accum4_h */
@@ -0,0 +1,58 @@
+//
+//  accum5.hpp
+//  cpptemples-ch19
+//
+
+#ifndef accum5_h
+#define accum5_h
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "accum4.hpp"
+#include "../common/thread_pool.hpp"
+
+struct parallel_tag {
+};
+
+inline constexpr parallel_tag parallel{};
+
+// smallest number of elements worth a chunk of its own
+inline constexpr std::size_t accum_min_chunk = std::size_t(1) << 16;
+
+// splits random-access ranges into chunks accumulated on the thread pool,
+// then merges the partial results in order with Policy::combine();
+// small ranges and non-associative policies are accumulated by one thread
+template <typename Iter, template <typename> class Policy = sum_policy>
+auto accum(parallel_tag, Iter beg, Iter end,
+           thread_pool& pool = thread_pool::instance())
+{
+    using value_type = typename std::iterator_traits<Iter>::value_type;
+    using policy = Policy<value_type>;
+
+    if constexpr (std::random_access_iterator<Iter>
+                  && is_associative_policy_v<policy>) {
+        std::size_t n = static_cast<std::size_t>(end - beg);
+        // a few chunks per thread, so that a slow thread can't stall the rest
+        std::size_t chunks = std::min<std::size_t>(4 * pool.concurrency(),
+                                                   n / accum_min_chunk);
+        if (chunks > 1) {
+            using accum_type = typename policy::accum_type;
+            std::vector<accum_type> partials(chunks);
+            pool.parallel_for(chunks, [&](std::size_t i) {
+                partials[i] = accum<Iter, Policy>(beg + n * i / chunks,
+                                                  beg + n * (i + 1) / chunks);
+            });
+            accum_type total = policy::identity();
+            for (auto const& partial : partials) {
+                total = policy::combine(total, partial);
+            }
+            return total;
+        }
+    }
+    return accum<Iter, Policy>(beg, end);
+}
+
+#endif /* accum5_h */
@@ -0,0 +1,74 @@
+//
+//  accum_bench.cpp
+//  cpptemples-ch19
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include "accum4.hpp"
+
+// plain sum in the element type; declaring it associative lets accum
+// reorder float additions too (the result may differ in the last bits)
+template <typename T>
+struct relaxed_sum_policy {
+    using value_type = T;
+    using accum_type = T;
+    static constexpr accum_type identity() {
+        return 0;
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return total + value;
+    }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return lhs + rhs;
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
+};
+
+template <typename F>
+void measure(char const* name, std::size_t bytes, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto result = f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << bytes / d.count() / 1e9 << " GB/s (result "
+              << result << ")\n";
+}
+
+template <typename T, template <typename> class Policy>
+void compare(char const* type, std::size_t bytes)
+{
+    // small values, so that the sums fit even the narrow accumulators
+    std::vector<T> v(bytes / sizeof(T));
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<T>(i % 2);
+    }
+    std::cout << type << " x " << v.size() << '\n';
+    measure("  serial", bytes, [&] {
+        return accum_serial<Policy<T>>(v.begin(), v.end());
+    });
+    measure("  lanes ", bytes, [&] {
+        return accum<typename std::vector<T>::iterator, Policy>(v.begin(), v.end());
+    });
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t bytes = std::size_t(1) << 30;   // 1 GB per buffer
+    if (argc > 1) {
+        bytes = std::strtoull(argv[1], nullptr, 10);
+    }
+
+    // non-contiguous ranges keep using the sequential loop
+    std::list<char> l = { 1, 2, 3 };
+    std::cout << "list<char>: " << accum(l.begin(), l.end()) << '\n';
+
+    compare<char, sum_policy>("char", bytes);
+    compare<int, relaxed_sum_policy>("int", bytes);
+    compare<float, relaxed_sum_policy>("float", bytes);
+}
@@ -0,0 +1,57 @@
+//
+//  accum_fused.cpp
+//  cpptemples-ch19
+//
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "accum_fused.hpp"
+
+using stats = fused<sum_policy, min_policy, max_policy, moments_policy>;
+
+template <typename F>
+void measure(char const* name, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto [sum, lo, hi, m] = f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << d.count() * 1e3 << " ms (sum " << double(sum)
+              << ", min " << lo << ", max " << hi << ", mean " << m.mean
+              << ", variance " << m.variance() << ")\n";
+}
+
+int main()
+{
+    std::vector<float> v(1 << 26);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<float>(i % 1000) / 10;
+    }
+    using Iter = std::vector<float>::const_iterator;
+
+    // one pass per statistic vs. one fused pass
+    measure("separate passes", [&] {
+        return std::tuple(accum<Iter, sum_policy>(v.cbegin(), v.cend()),
+                          accum<Iter, min_policy>(v.cbegin(), v.cend()),
+                          accum<Iter, max_policy>(v.cbegin(), v.cend()),
+                          accum<Iter, moments_policy>(v.cbegin(), v.cend()));
+    });
+    measure("fused pass     ", [&] {
+        return accum<Iter, stats::policy>(v.cbegin(), v.cend());
+    });
+
+    // streaming: two sources filled chunk by chunk, then merged
+    measure("streamed       ", [&] {
+        aggregator<float, stats::policy> first, second;
+        std::size_t half = v.size() / 2;
+        for (std::size_t i = 0; i < half; i += 4096) {
+            first.push(v.cbegin() + i, v.cbegin() + i + 4096);
+        }
+        for (std::size_t i = half; i < v.size(); ++i) {
+            second.push(v[i]);
+        }
+        first.merge(second);
+        return first.result();
+    });
+}
@@ -0,0 +1,210 @@
+//
+//  accum_fused.hpp
+//  cpptemples-ch19
+//
+
+#ifndef accum_fused_h
+#define accum_fused_h
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "accum4.hpp"
+
+template <typename T>
+struct min_policy {
+public:
+    using value_type = T;
+    using accum_type = T;
+    static constexpr accum_type identity() {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return std::numeric_limits<T>::infinity();
+        }
+        else {
+            return std::numeric_limits<T>::max();
+        }
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return value < total ? value : total;
+    }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return accum(lhs, rhs);
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
+};
+
+template <typename T>
+struct max_policy {
+public:
+    using value_type = T;
+    using accum_type = T;
+    static constexpr accum_type identity() {
+        if constexpr (std::numeric_limits<T>::has_infinity) {
+            return -std::numeric_limits<T>::infinity();
+        }
+        else {
+            return std::numeric_limits<T>::lowest();
+        }
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return total < value ? value : total;
+    }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return accum(lhs, rhs);
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
+};
+
+// count, mean and sum of squared deviations, updated with Welford's method
+struct moments {
+    std::size_t count = 0;
+    double mean = 0;
+    double m2 = 0;
+
+    constexpr double variance() const {         // population variance
+        return count > 0 ? m2 / count : 0;
+    }
+    constexpr double sample_variance() const {
+        return count > 1 ? m2 / (count - 1) : 0;
+    }
+};
+
+template <typename T>
+struct moments_policy {
+public:
+    using value_type = T;
+    using accum_type = moments;
+    static constexpr accum_type identity() {
+        return {};
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        ++total.count;
+        double delta = value - total.mean;
+        total.mean += delta / total.count;
+        total.m2 += delta * (value - total.mean);
+        return total;
+    }
+    // Chan et al.'s formula for merging two partial results
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        if (lhs.count == 0) {
+            return rhs;
+        }
+        if (rhs.count == 0) {
+            return lhs;
+        }
+        std::size_t count = lhs.count + rhs.count;
+        double delta = rhs.mean - lhs.mean;
+        lhs.mean += delta * rhs.count / count;
+        lhs.m2 += rhs.m2 + delta * delta * lhs.count * rhs.count / count;
+        lhs.count = count;
+        return lhs;
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
+};
+
+// fuses several policies into one, so that accum computes all of them in a
+// single pass; the result is a tuple with one entry per policy:
+//
+//   auto [sum, lo, hi] = accum<Iter, fused<sum_policy, min_policy,
+//                                          max_policy>::policy>(beg, end);
+template <template <typename> class... Policies>
+struct fused {
+    template <typename T>
+    struct policy {
+    public:
+        using value_type = T;
+        using accum_type = std::tuple<typename Policies<T>::accum_type...>;
+        static constexpr accum_type identity() {
+            return accum_type(Policies<T>::identity()...);
+        }
+        static constexpr accum_type accum(accum_type total, value_type value) {
+            return accum(std::move(total), value, indices{});
+        }
+        static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+            return combine(std::move(lhs), std::move(rhs), indices{});
+        }
+        // contiguous input (used by accum): still a single pass over memory,
+        // but in blocks that stay in L1, each run through the lanes of every
+        // policy on its own; lanes holding whole tuples interleave the
+        // accumulators of different policies, which doesn't vectorize
+        static accum_type accum_range(value_type const* beg, value_type const* end) {
+            return accum_range(beg, end, indices{});
+        }
+        static constexpr bool is_associative =
+            (is_associative_policy_v<Policies<T>> && ...);
+        static constexpr bool is_commutative =
+            (is_commutative_policy_v<Policies<T>> && ...);
+
+    private:
+        using indices = std::index_sequence_for<Policies<T>...>;
+
+        template <std::size_t... I>
+        static constexpr accum_type accum(accum_type total, value_type value,
+                                          std::index_sequence<I...>) {
+            ((std::get<I>(total) = Policies<T>::accum(std::get<I>(total), value)), ...);
+            return total;
+        }
+        template <std::size_t... I>
+        static accum_type accum_range(value_type const* beg, value_type const* end,
+                                      std::index_sequence<I...>) {
+            constexpr std::size_t block = 16 * 1024 / sizeof(value_type);
+            accum_type total = identity();
+            while (beg != end) {
+                std::size_t n = std::min<std::size_t>(end - beg, block);
+                ((std::get<I>(total) = Policies<T>::combine(std::get<I>(total),
+                     accum_lanes<Policies<T>>(beg, beg + n))), ...);
+                beg += n;
+            }
+            return total;
+        }
+        template <std::size_t... I>
+        static constexpr accum_type combine(accum_type lhs, accum_type const& rhs,
+                                            std::index_sequence<I...>) {
+            ((std::get<I>(lhs) = Policies<T>::combine(std::get<I>(lhs),
+                                                      std::get<I>(rhs))), ...);
+            return lhs;
+        }
+    };
+};
+
+// accumulates input that arrives in pieces (e.g. chunks read from a file or
+// a socket); aggregators filled independently can be merged
+template <typename T, template <typename> class Policy>
+class aggregator {
+public:
+    using accum_type = typename Policy<T>::accum_type;
+
+    void push(T const& value) {
+        total = Policy<T>::accum(std::move(total), value);
+    }
+    template <typename Iter>
+    void push(Iter beg, Iter end) {
+        if constexpr (is_associative_policy_v<Policy<T>>) {
+            total = Policy<T>::combine(std::move(total), ::accum<Iter, Policy>(beg, end));
+        }
+        else {
+            for (; beg != end; ++beg) {
+                push(*beg);
+            }
+        }
+    }
+    void merge(aggregator const& other) {
+        static_assert(is_associative_policy_v<Policy<T>>,
+                      "merging requires an associative policy");
+        total = Policy<T>::combine(std::move(total), other.total);
+    }
+    accum_type const& result() const {
+        return total;
+    }
+
+private:
+    accum_type total = Policy<T>::identity();
+};
+
+#endif /* accum_fused_h */
@@ -0,0 +1,49 @@
+//
+//  accum_parallel_bench.cpp
+//  cpptemples-ch19
+//
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "accum5.hpp"
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = std::size_t(1) << 30;  // elements
+    if (argc > 1) {
+        n = std::strtoull(argv[1], nullptr, 10);
+    }
+    std::vector<char> v(n);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<char>(i % 2);
+    }
+
+    auto measure = [&](auto f) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = f();
+        std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+        std::cout << n / d.count() / 1e9 << " G elems/s (result " << result << ")\n";
+        return d.count();
+    };
+
+    std::cout << "single-threaded accum: ";
+    measure([&] { return accum(v.begin(), v.end()); });
+
+    unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+    if (argc > 2) {
+        cores = std::max(static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)), 1u);
+    }
+    // 1, 2, 4, ... threads, always ending with all cores (e.g. 1, 2, 4, 6)
+    for (unsigned threads = 1; ; threads = std::min(threads * 2, cores)) {
+        thread_pool pool(threads - 1);
+        std::cout << threads << " thread(s): ";
+        measure([&] { return accum(parallel, v.begin(), v.end(), pool); });
+        if (threads == cores) {
+            break;
+        }
+    }
+}
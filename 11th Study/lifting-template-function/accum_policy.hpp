@@ -9,37 +9,211 @@
 #ifndef accum_policy_h
 #define accum_policy_h
 
-template <typename>
-struct sum_policy;
+#include "../common/integral_constant.hpp"
+#include "../common/void_type.hpp"
 
-template <>
-struct sum_policy<char> {
+#include "accum_traits.hpp"
+
+// sums in the accumulator type of accum_traits: overflow-safe for integers,
+// double for float
+template <typename T>
+struct arithmetic_sum_policy {
 public:
-    using value_type = char;
-    using accum_type = int;
+    using value_type = T;
+    using accum_type = typename accum_traits<T>::type;
     static constexpr accum_type identity() {
         return 0;
     }
     static constexpr accum_type accum(accum_type total, value_type value) {
         return total + value;
     }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return lhs + rhs;
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
 };
 
+// opt-in: sums floating-point values with Kahan compensation; reordering
+// changes the rounding, but every partial sum is compensated, so the result
+// stays accurate; the result is a compensated_sum (explicit conversion)
+template <typename T>
+struct compensated_sum_policy {
+public:
+    using value_type = T;
+    using accum_type = compensated_sum<typename accum_traits<T>::type>;
+    static constexpr accum_type identity() {
+        return {};
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return total + value;
+    }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return lhs + rhs;
+    }
+    static constexpr bool is_associative = true;
+    static constexpr bool is_commutative = true;
+};
 
 template <typename>
-struct mult_policy;
+struct sum_policy;
+
+template <>
+struct sum_policy<char> : arithmetic_sum_policy<char> {
+};
+
+template <>
+struct sum_policy<signed char> : arithmetic_sum_policy<signed char> {
+};
+
+template <>
+struct sum_policy<unsigned char> : arithmetic_sum_policy<unsigned char> {
+};
+
+template <>
+struct sum_policy<short> : arithmetic_sum_policy<short> {
+};
+
+template <>
+struct sum_policy<unsigned short> : arithmetic_sum_policy<unsigned short> {
+};
+
+template <>
+struct sum_policy<int> : arithmetic_sum_policy<int> {
+};
+
+template <>
+struct sum_policy<unsigned> : arithmetic_sum_policy<unsigned> {
+};
+
+template <>
+struct sum_policy<long> : arithmetic_sum_policy<long> {
+};
+
+template <>
+struct sum_policy<unsigned long> : arithmetic_sum_policy<unsigned long> {
+};
+
+template <>
+struct sum_policy<long long> : arithmetic_sum_policy<long long> {
+};
+
+template <>
+struct sum_policy<unsigned long long> : arithmetic_sum_policy<unsigned long long> {
+};
+
+template <>
+struct sum_policy<float> : arithmetic_sum_policy<float> {
+};
+
+template <>
+struct sum_policy<double> : arithmetic_sum_policy<double> {
+};
 
 template <>
-struct mult_policy<char> {
+struct sum_policy<long double> : arithmetic_sum_policy<long double> {
+};
+
+// multiplies in the accumulator type of accum_traits; floating-point products
+// are rounded differently when reordered, so only integers are associative
+template <typename T>
+struct arithmetic_mult_policy {
 public:
-    using value_type = char;
-    using accum_type = int;
+    using value_type = T;
+    using accum_type = typename accum_traits<T>::type;
     static constexpr accum_type identity() {
         return 1;
     }
     static constexpr accum_type accum(accum_type total, value_type value) {
         return total * value;
     }
+    static constexpr accum_type combine(accum_type lhs, accum_type rhs) {
+        return lhs * rhs;
+    }
+    static constexpr bool is_associative = std::is_integral_v<T>;
+    static constexpr bool is_commutative = std::is_integral_v<T>;
+};
+
+template <typename>
+struct mult_policy;
+
+template <>
+struct mult_policy<char> : arithmetic_mult_policy<char> {
+};
+
+template <>
+struct mult_policy<signed char> : arithmetic_mult_policy<signed char> {
+};
+
+template <>
+struct mult_policy<unsigned char> : arithmetic_mult_policy<unsigned char> {
+};
+
+template <>
+struct mult_policy<short> : arithmetic_mult_policy<short> {
+};
+
+template <>
+struct mult_policy<unsigned short> : arithmetic_mult_policy<unsigned short> {
+};
+
+template <>
+struct mult_policy<int> : arithmetic_mult_policy<int> {
+};
+
+template <>
+struct mult_policy<unsigned> : arithmetic_mult_policy<unsigned> {
 };
 
+template <>
+struct mult_policy<long> : arithmetic_mult_policy<long> {
+};
+
+template <>
+struct mult_policy<unsigned long> : arithmetic_mult_policy<unsigned long> {
+};
+
+template <>
+struct mult_policy<long long> : arithmetic_mult_policy<long long> {
+};
+
+template <>
+struct mult_policy<unsigned long long> : arithmetic_mult_policy<unsigned long long> {
+};
+
+template <>
+struct mult_policy<float> : arithmetic_mult_policy<float> {
+};
+
+template <>
+struct mult_policy<double> : arithmetic_mult_policy<double> {
+};
+
+template <>
+struct mult_policy<long double> : arithmetic_mult_policy<long double> {
+};
+
+// a policy may declare that its operation is associative / commutative,
+// which allows accum to split the input and combine partial results;
+// policies that don't say so are always accumulated strictly in order
+template <typename Policy, typename = void_t<>>
+struct is_associative_policy : false_type {};
+
+template <typename Policy>
+struct is_associative_policy<Policy, void_t<decltype(Policy::is_associative)>>
+    : bool_constant<Policy::is_associative> {};
+
+template <typename Policy>
+constexpr bool is_associative_policy_v = is_associative_policy<Policy>::value;
+
+template <typename Policy, typename = void_t<>>
+struct is_commutative_policy : false_type {};
+
+template <typename Policy>
+struct is_commutative_policy<Policy, void_t<decltype(Policy::is_commutative)>>
+    : bool_constant<Policy::is_commutative> {};
+
+template <typename Policy>
+constexpr bool is_commutative_policy_v = is_commutative_policy<Policy>::value;
+
 #endif /* accum_policy_h */
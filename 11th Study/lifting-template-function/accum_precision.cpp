@@ -0,0 +1,106 @@
+//
+//  accum_precision.cpp
+//  cpptemples-ch19
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "accum1.hpp"
+#include "accum4.hpp"
+
+static_assert(std::is_same_v<accum_traits<int>::type, long long>);
+static_assert(accum_traits<char>::max_fast_count
+              == std::numeric_limits<int>::max() / 128);
+static_assert(accum_traits<int>::max_fast_count == (std::size_t(1) << 32) - 1);
+constexpr std::size_t maxFastChars = accum_traits<char>::max_fast_count;
+static_assert(accum_uses_fast_type<char>(maxFastChars));
+static_assert(!accum_uses_fast_type<char>(maxFastChars + 1));
+static_assert(!accum_uses_fast_type<int>(2));     // fast == wide for int
+// the default policy returns a plain number; Kahan summation is opt-in
+static_assert(std::is_same_v<decltype(accum(std::declval<float const*>(),
+                                            std::declval<float const*>())), double>);
+
+// rounds every addition to float, like a plain float loop
+struct naive_float_sum_policy {
+    using value_type = float;
+    using accum_type = float;
+    static constexpr accum_type identity() {
+        return 0;
+    }
+    static constexpr accum_type accum(accum_type total, value_type value) {
+        return total + value;
+    }
+};
+
+// maxFastChars is the longest array whose sum fits in int for any chars
+// (|c| <= 128), so one more element selects the long long path (see the
+// static_asserts above); both must sum exactly
+char fastChars[maxFastChars];
+char wideChars[maxFastChars + 1];
+
+void check(char const* name, long long sum, long long expected)
+{
+    std::cout << name << ' ' << sum << (sum == expected ? " (exact)\n" : " (WRONG)\n");
+}
+
+template <typename F>
+void measure(char const* name, std::size_t n, double exact, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    double result = f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << n / d.count() / 1e9 << " G elems/s, relative error "
+              << std::abs(result - exact) / exact << '\n';
+}
+
+int main()
+{
+    // integers: char const* selects accum1's accum (a char* would pick the
+    // policy-based accum of accum4.hpp); 20M chars of 127 exceed the int
+    // fast path, but not long long
+    std::vector<char> chars(20'000'000, 127);
+    check("char sum (wide)        ", accum(std::as_const(chars).data(),
+                                           std::as_const(chars).data() + chars.size()),
+          127LL * 20'000'000);
+    // accum4.hpp's sum_policy sums it in int blocks of maxFastChars as well
+    check("char sum (policy)      ", accum(chars.begin(), chars.end()), 127LL * 20'000'000);
+    std::fill(std::begin(fastChars), std::end(fastChars), 127);
+    std::fill(std::begin(wideChars), std::end(wideChars), 127);
+    char const* fast = fastChars;
+    char const* wide = wideChars;
+    check("char pointers (fast)   ", accum(fast, fast + maxFastChars),
+          127LL * maxFastChars);
+    check("char pointers (wide)   ", accum(wide, wide + maxFastChars + 1),
+          127LL * (maxFastChars + 1));
+    check("char array (fast)      ", accum(std::as_const(fastChars)), 127LL * maxFastChars);
+    check("char array (wide)      ", accum(std::as_const(wideChars)),
+          127LL * (maxFastChars + 1));
+    int ints[] = { std::numeric_limits<int>::max(), std::numeric_limits<int>::max() };
+    std::cout << "int array sum " << accum(ints) << '\n';
+
+    // floats: 100M times 0.1f, exact result computed in long double
+    std::size_t n = 100'000'000;
+    std::vector<float> floats(n, 0.1f);
+    double exact = static_cast<double>(n * static_cast<long double>(0.1f));
+    measure("naive float      ", n, exact, [&] {
+        return accum_serial<naive_float_sum_policy>(floats.begin(), floats.end());
+    });
+    measure("double (default) ", n, exact, [&] {
+        return accum(floats.begin(), floats.end());
+    });
+    measure("compensated      ", n, exact, [&] {
+        return double(accum_serial<compensated_sum_policy<float>>(floats.begin(),
+                                                                   floats.end()));
+    });
+    measure("compensated lanes", n, exact, [&] {
+        using Iter = std::vector<float>::iterator;
+        return double(accum<Iter, compensated_sum_policy>(floats.begin(), floats.end()));
+    });
+}
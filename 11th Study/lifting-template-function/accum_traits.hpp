@@ -0,0 +1,137 @@
+//
+//  accum_traits.hpp
+//  cpptemples-ch19
+//
+
+#ifndef accum_traits_h
+#define accum_traits_h
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+template <typename>
+struct accum_traits;
+
+// number of T values that can be summed in Acc without overflow
+template <typename T, typename Acc>
+constexpr std::size_t no_overflow_count()
+{
+    if constexpr (std::is_floating_point_v<Acc>) {
+        return std::numeric_limits<std::size_t>::max();
+    }
+    else {
+        using ull = unsigned long long;
+        constexpr ull max_value = std::numeric_limits<T>::max();
+        constexpr ull max_magnitude = std::is_signed_v<T>
+            ? ull(-(std::numeric_limits<T>::min() + 1)) + 1
+            : max_value;
+        constexpr ull count = ull(std::numeric_limits<Acc>::max()) / max_magnitude;
+        return count < std::numeric_limits<std::size_t>::max()
+            ? static_cast<std::size_t>(count)
+            : std::numeric_limits<std::size_t>::max();
+    }
+}
+
+// - type: accumulator wide enough for any realistic input; for inputs
+//   narrower than 64 bits it overflows only after more than 2^32 elements
+// - fast_type: narrower accumulator for inputs of up to max_fast_count elements
+template <typename T, typename Wide, typename Fast = Wide>
+struct arithmetic_accum_traits {
+    using type = Wide;
+    using fast_type = Fast;
+    static constexpr std::size_t max_fast_count = no_overflow_count<T, Fast>();
+    static constexpr type identity() {
+        return 0;
+    }
+};
+
+template <>
+struct accum_traits<char> : arithmetic_accum_traits<char, long long, int> {
+};
+
+template <>
+struct accum_traits<signed char> : arithmetic_accum_traits<signed char, long long, int> {
+};
+
+template <>
+struct accum_traits<unsigned char>
+    : arithmetic_accum_traits<unsigned char, unsigned long long, unsigned> {
+};
+
+template <>
+struct accum_traits<short> : arithmetic_accum_traits<short, long long, int> {
+};
+
+template <>
+struct accum_traits<unsigned short>
+    : arithmetic_accum_traits<unsigned short, unsigned long long, unsigned> {
+};
+
+template <>
+struct accum_traits<int> : arithmetic_accum_traits<int, long long> {
+};
+
+template <>
+struct accum_traits<unsigned> : arithmetic_accum_traits<unsigned, unsigned long long> {
+};
+
+// no wider standard type for 64-bit inputs: these can still overflow
+template <>
+struct accum_traits<long> : arithmetic_accum_traits<long, long long> {
+};
+
+template <>
+struct accum_traits<unsigned long>
+    : arithmetic_accum_traits<unsigned long, unsigned long long> {
+};
+
+template <>
+struct accum_traits<long long> : arithmetic_accum_traits<long long, long long> {
+};
+
+template <>
+struct accum_traits<unsigned long long>
+    : arithmetic_accum_traits<unsigned long long, unsigned long long> {
+};
+
+template <>
+struct accum_traits<float> : arithmetic_accum_traits<float, double> {
+};
+
+template <>
+struct accum_traits<double> : arithmetic_accum_traits<double, double> {
+};
+
+template <>
+struct accum_traits<long double> : arithmetic_accum_traits<long double, long double> {
+};
+
+// Kahan summation: correction keeps the low-order bits that got lost when
+// adding to sum (don't compile with -ffast-math, which optimizes it away)
+template <typename F>
+struct compensated_sum {
+    F sum {};
+    F correction {};
+
+    constexpr F value() const {
+        return sum - correction;
+    }
+    explicit constexpr operator F() const {
+        return value();
+    }
+
+    friend constexpr compensated_sum operator+(compensated_sum total, F value) {
+        F y = value - total.correction;
+        F t = total.sum + y;
+        total.correction = (t - total.sum) - y;
+        total.sum = t;
+        return total;
+    }
+    friend constexpr compensated_sum operator+(compensated_sum lhs,
+                                               compensated_sum rhs) {
+        return (lhs + rhs.sum) + -rhs.correction;
+    }
+};
+
+#endif /* accum_traits_h */
@@ -9,11 +9,22 @@
 #ifndef read_only_param_h
 #define read_only_param_h
 
-#include "../other-traits/technique/if_then_else.hpp"
+#include <type_traits>
 
+#include "../other-traits-technique/if_then_else.hpp"
+
+// by value only if T fits in two registers and copying it is a plain
+// memcpy: a class with a user-provided copy constructor or destructor is
+// passed by the ABI through a hidden reference anyway, and would pay for
+// the copy on top
 template <typename T>
 struct read_only_param {
-    using type = typename if_then_else<sizeof(T)<=2*sizeof(void*), T, T const&>::type;
+    using type = typename if_then_else<sizeof(T) <= 2*sizeof(void*)
+                                       && std::is_trivially_copyable<T>::value,
+                                       T, T const&>::type;
 };
 
+template <typename T>
+using read_only_param_t = typename read_only_param<T>::type;
+
 #endif /* read_only_param_h */
@@ -0,0 +1,84 @@
+#include "functionptr.hpp"
+#include "functionref.hpp"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_trivially_copyable_v<function_ref<void(int)>>);
+static_assert(sizeof(function_ref<void(int)>) == 2 * sizeof(void*));
+
+// the forUpTo() variants of section 22.1/22.2 (not inlined into the caller,
+// as if they were defined in another translation unit)
+template<typename F>
+[[gnu::noinline]] void forUpTo(int n, F f)
+{
+	for (int i = 0; i != n; ++i)
+	{
+		f(i); // call passed function f for i
+	}
+}
+
+[[gnu::noinline]] void forUpToRef(int n, function_ref<void(int)> f)
+{
+	for (int i = 0; i != n; ++i)
+	{
+		f(i);
+	}
+}
+
+[[gnu::noinline]] void forUpToPtr(int n, FunctionPtr<void(int)> f)
+{
+	for (int i = 0; i != n; ++i)
+	{
+		f(i);
+	}
+}
+
+[[gnu::noinline]] void forUpToStd(int n, std::function<void(int)> f)
+{
+	for (int i = 0; i != n; ++i)
+	{
+		f(i);
+	}
+}
+
+void printInt(int i)
+{
+	std::cout << i << ' ';
+}
+
+template<typename F>
+void measure(char const* name, int n, F forUpToN)
+{
+	long sum = 0;
+	auto start = std::chrono::steady_clock::now();
+	// the empty asm hides i from the optimizer, so the inlined template
+	// variant can't replace the loop by a closed form and each variant
+	// really calls the callback once per element
+	forUpToN(n, [&sum](int i) {
+		asm volatile("" : "+r"(i));
+		sum += i;
+	});
+	std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+	std::cout << name << d.count() / n * 1e9 << " ns per call (sum " << sum << ")\n";
+}
+
+int main()
+{
+	std::vector<int> values;
+	// insert values from 0 to 4:
+	forUpToRef(5, [&values](int i) {
+		values.push_back(i);
+	});
+	// print elements:
+	forUpToRef(5, printInt);	// prints 0 1 2 3 4
+	std::cout << '\n';
+
+	int n = 100'000'000;
+	measure("template parameter:   ", n, [](int n, auto f) { forUpTo(n, f); });
+	measure("function_ref:         ", n, [](int n, auto f) { forUpToRef(n, f); });
+	measure("FunctionPtr:          ", n, [](int n, auto f) { forUpToPtr(n, f); });
+	measure("std::function:        ", n, [](int n, auto f) { forUpToStd(n, f); });
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>	// for std::invoke() and std::bad_function_call
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// FunctionPtr of section 22.2 without virtual functions and, for functors of
+// up to BufferSize bytes, without heap allocation:
+// - the functor is stored in an inline buffer (larger ones on the heap)
+// - the bridge is a table of function pointers, one static table per functor
+//   type, instead of a FunctorBridge object with virtual clone()/invoke()
+// - with Copyable == false, move-only functors can be stored
+template<typename Signature, std::size_t BufferSize, bool Copyable>
+class BasicFunctionPtr;
+
+template<typename R, typename... Args, std::size_t BufferSize, bool Copyable>
+class BasicFunctionPtr<R(Args...), BufferSize, Copyable>
+{
+	static_assert(BufferSize >= sizeof(void*), "buffer must be able to hold a pointer");
+private:
+	// manually built "vtable"; nullptr entries mean: memcpy() / nothing to do
+	struct Bridge {
+		R (*invoke)(void* storage, Args&&... args);
+		void (*copy)(void const* from, void* to);		// nullptr if !Copyable
+		void (*move)(void* from, void* to) noexcept;	// also destroys *from
+		void (*destroy)(void* storage) noexcept;
+	};
+
+	template<typename Functor>
+	static constexpr bool storedInline = sizeof(Functor) <= BufferSize
+		&& alignof(Functor) <= alignof(std::max_align_t)
+		&& std::is_nothrow_move_constructible_v<Functor>;
+
+	// functor constructed inside the buffer
+	template<typename Functor>
+	struct InlineBridge {
+		static Functor* get(void* storage) {
+			return std::launder(static_cast<Functor*>(storage));
+		}
+		static R invoke(void* storage, Args&&... args) {
+			return std::invoke(*get(storage), std::forward<Args>(args)...);
+		}
+		static void copy(void const* from, void* to) {
+			if constexpr (Copyable) {	// never instantiated for move-only functors
+				::new (to) Functor(*get(const_cast<void*>(from)));
+			}
+		}
+		static void move(void* from, void* to) noexcept {
+			::new (to) Functor(std::move(*get(from)));
+			get(from)->~Functor();
+		}
+		static void destroy(void* storage) noexcept {
+			get(storage)->~Functor();
+		}
+		static constexpr bool trivial = std::is_trivially_copyable_v<Functor>;
+		static constexpr Bridge table = {
+			&invoke,
+			trivial || !Copyable ? nullptr : &copy,
+			trivial ? nullptr : &move,
+			trivial ? nullptr : &destroy
+		};
+	};
+
+	// buffer holds a pointer to the functor on the heap
+	template<typename Functor>
+	struct HeapBridge {
+		static Functor* get(void const* storage) {
+			Functor* p;
+			std::memcpy(&p, storage, sizeof(p));
+			return p;
+		}
+		static R invoke(void* storage, Args&&... args) {
+			return std::invoke(*get(storage), std::forward<Args>(args)...);
+		}
+		static void copy(void const* from, void* to) {
+			if constexpr (Copyable) {
+				Functor* p = new Functor(*get(from));
+				std::memcpy(to, &p, sizeof(p));
+			}
+		}
+		static void destroy(void* storage) noexcept {
+			delete get(storage);
+		}
+		static constexpr Bridge table = {
+			&invoke, Copyable ? &copy : nullptr, nullptr, &destroy
+		};
+	};
+
+	static R invokeEmpty(void*, Args&&...) {
+		throw std::bad_function_call();
+	}
+	static constexpr Bridge emptyBridge = { &invokeEmpty, nullptr, nullptr, nullptr };
+
+	alignas(std::max_align_t) mutable unsigned char buffer[BufferSize];
+	Bridge const* bridge;
+
+	template<typename F>
+	static constexpr bool isFunctor = !std::is_same_v<std::decay_t<F>, BasicFunctionPtr>
+		&& std::is_invocable_r_v<R, std::decay_t<F>&, Args...>;
+
+public:
+	// constructors:
+	BasicFunctionPtr() noexcept : bridge(&emptyBridge) {
+	}
+	BasicFunctionPtr(std::nullptr_t) noexcept : bridge(&emptyBridge) {
+	}
+	BasicFunctionPtr(BasicFunctionPtr const& other) requires Copyable;
+	BasicFunctionPtr(BasicFunctionPtr&& other) noexcept : bridge(other.bridge) {
+		moveBuffer(other);
+	}
+	// construction from arbitrary function objects:
+	template<typename F> requires isFunctor<F>
+	BasicFunctionPtr(F&& f)
+		: bridge(&emptyBridge)
+	{
+		using Functor = std::decay_t<F>;
+		static_assert(!Copyable || std::is_copy_constructible_v<Functor>,
+			"use MoveOnlyFunctionPtr for move-only functors");
+		if constexpr (std::is_pointer_v<std::remove_reference_t<F>>
+			|| std::is_member_pointer_v<Functor>) {
+			if (f == nullptr) {
+				return;					// null function pointer: empty
+			}
+		}
+		if constexpr (storedInline<Functor>) {
+			::new (static_cast<void*>(buffer)) Functor(std::forward<F>(f));
+			bridge = &InlineBridge<Functor>::table;
+		}
+		else {
+			Functor* p = new Functor(std::forward<F>(f));
+			std::memcpy(buffer, &p, sizeof(p));
+			bridge = &HeapBridge<Functor>::table;
+		}
+	}
+
+	BasicFunctionPtr& operator=(BasicFunctionPtr const& other) requires Copyable {
+		BasicFunctionPtr tmp(other);
+		swap(*this, tmp);
+		return *this;
+	}
+	BasicFunctionPtr& operator=(BasicFunctionPtr&& other) noexcept {
+		if (this != &other) {
+			reset();
+			bridge = other.bridge;
+			moveBuffer(other);
+		}
+		return *this;
+	}
+	// assignment from arbitrary function objects:
+	template<typename F> requires isFunctor<F>
+	BasicFunctionPtr& operator=(F&& f) {
+		BasicFunctionPtr tmp(std::forward<F>(f));
+		swap(*this, tmp);
+		return *this;
+	}
+	// destructor:
+	~BasicFunctionPtr() {
+		reset();
+	}
+	friend void swap(BasicFunctionPtr& fp1, BasicFunctionPtr& fp2) noexcept {
+		BasicFunctionPtr tmp(std::move(fp1));
+		fp1 = std::move(fp2);
+		fp2 = std::move(tmp);
+	}
+	explicit operator bool() const {
+		return bridge != &emptyBridge;
+	}
+	// invocation (throws std::bad_function_call if empty):
+	R operator()(Args... args) const;
+
+private:
+	void reset() noexcept {
+		if (bridge->destroy) {
+			bridge->destroy(buffer);
+		}
+		bridge = &emptyBridge;
+	}
+	// take over the functor of other (bridge is already set); other is empty afterwards
+	void moveBuffer(BasicFunctionPtr& other) noexcept {
+		if (bridge->move) {
+			bridge->move(other.buffer, buffer);
+		}
+		else {
+			std::memcpy(buffer, other.buffer, BufferSize);
+		}
+		other.bridge = &emptyBridge;
+	}
+};
+
+template<typename R, typename... Args, std::size_t BufferSize, bool Copyable>
+BasicFunctionPtr<R(Args...), BufferSize, Copyable>::BasicFunctionPtr(BasicFunctionPtr const& other)
+	requires (Copyable)
+	: bridge(other.bridge)
+{
+	if (bridge->copy) {
+		bridge->copy(other.buffer, buffer);
+	}
+	else {
+		std::memcpy(buffer, other.buffer, BufferSize);
+	}
+}
+
+template<typename R, typename... Args, std::size_t BufferSize, bool Copyable>
+R BasicFunctionPtr<R(Args...), BufferSize, Copyable>::operator()(Args... args) const
+{
+	return bridge->invoke(buffer, std::forward<Args>(args)...);
+}
+
+template<typename Signature, std::size_t BufferSize = 32>
+using FunctionPtr = BasicFunctionPtr<Signature, BufferSize, true>;
+
+template<typename Signature, std::size_t BufferSize = 32>
+using MoveOnlyFunctionPtr = BasicFunctionPtr<Signature, BufferSize, false>;
@@ -0,0 +1,107 @@
+#include "functionptr.hpp"
+#include <array>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+void forUpTo(int n, FunctionPtr<void(int)> f)
+{
+	for (int i = 0; i != n; ++i)
+	{
+		f(i); // call passed function f for i
+	}
+}
+
+void printInt(int i)
+{
+	std::cout << i << ' ';
+}
+
+// lambda with Captures bytes of captured state
+template<std::size_t Captures>
+auto makeLambda()
+{
+	if constexpr (Captures == 0) {
+		return [](int i) { return i; };
+	}
+	else {
+		std::array<unsigned char, Captures> data{};
+		data[0] = 1;
+		return [data](int i) { return i + data[i % Captures]; };
+	}
+}
+
+template<typename F>
+double seconds(F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+	return d.count();
+}
+
+// construct (and destroy) a batch of callbacks, then invoke each of them,
+// repeated until n callbacks are handled (the batch stays in the cache)
+template<typename Fn, std::size_t Captures>
+void measure(char const* name, int n)
+{
+	constexpr int batch = 256;
+	auto lambda = makeLambda<Captures>();
+	std::vector<Fn> callbacks;
+	callbacks.reserve(batch);
+	double construct = seconds([&] {
+		for (int r = 0; r != n / batch; ++r) {
+			for (int i = 0; i != batch; ++i) {
+				callbacks.emplace_back(lambda);
+			}
+			callbacks.clear();
+		}
+	});
+	for (int i = 0; i != batch; ++i) {
+		callbacks.emplace_back(lambda);
+	}
+	long sum = 0;
+	double invoke = seconds([&] {
+		for (int r = 0; r != n / batch; ++r) {
+			for (int i = 0; i != batch; ++i) {
+				sum += callbacks[i](i);
+			}
+		}
+	});
+	std::cout << "  " << name << ": construct+destroy " << construct / n * 1e9
+		<< " ns, invoke " << invoke / n * 1e9 << " ns" << (sum == 42 ? " " : "") << '\n';
+}
+
+template<std::size_t Captures>
+void measureAll(int n)
+{
+	std::cout << Captures << " bytes of captures:\n";
+	measure<std::function<int(int)>, Captures>("std::function              ", n);
+	measure<FunctionPtr<int(int), 64>, Captures>("FunctionPtr<int(int),64>   ", n);
+	measure<MoveOnlyFunctionPtr<int(int), 64>, Captures>("MoveOnlyFunctionPtr<..,64> ", n);
+}
+
+int main()
+{
+	std::vector<int> values;
+	// insert values from 0 to 4:
+	forUpTo(5, [&values](int i) {
+		values.push_back(i);
+	});
+	// print elements:
+	forUpTo(5, printInt);	// prints 0 1 2 3 4
+	std::cout << '\n';
+
+	// move-only functors need MoveOnlyFunctionPtr:
+	MoveOnlyFunctionPtr<int()> owner = [p = std::make_unique<int>(42)] { return *p; };
+	MoveOnlyFunctionPtr<int()> newOwner = std::move(owner);
+	std::cout << newOwner() << ' ' << bool(owner) << '\n';
+
+	int n = 10'000'000;
+	measureAll<0>(n);
+	measureAll<16>(n);
+	measureAll<48>(n);
+	measureAll<128>(n);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>	// for std::invoke()
+#include <memory>		// for std::addressof()
+#include <type_traits>
+#include <utility>
+
+// non-owning reference to a callable: an object pointer plus a function
+// pointer that knows the object's type (two pointers, trivially copyable)
+// - nothing is allocated or copied, so the referenced callable has to outlive
+//   the function_ref; use it for callbacks that are invoked synchronously
+//   (like f in forUpTo()) and FunctionPtr for callbacks that are stored
+template<typename Signature>
+class function_ref;
+
+template<typename R, typename... Args>
+class function_ref<R(Args...)>
+{
+private:
+	union Target {
+		void* object;			// callable object
+		R (*function)(Args...);	// plain function
+	};
+	Target target;
+	R (*callback)(Target, Args&&...);
+
+public:
+	// refer to a function object (temporaries live until the end of the full expression):
+	template<typename F>
+		requires (!std::is_same_v<std::remove_cvref_t<F>, function_ref>
+			&& !std::is_function_v<std::remove_reference_t<F>>
+			&& std::is_invocable_r_v<R, F&, Args...>)
+	function_ref(F&& f) noexcept
+		: callback([](Target t, Args&&... args) -> R {
+			using Object = std::remove_reference_t<F>;
+			return std::invoke(*static_cast<Object*>(t.object), std::forward<Args>(args)...);
+		})
+	{
+		target.object = const_cast<void*>(static_cast<void const volatile*>(std::addressof(f)));
+	}
+	// refer to a plain function:
+	function_ref(R (*f)(Args...)) noexcept
+		: callback([](Target t, Args&&... args) -> R {
+			return t.function(std::forward<Args>(args)...);
+		})
+	{
+		target.function = f;
+	}
+
+	// invocation:
+	R operator()(Args... args) const {
+		return callback(target, std::forward<Args>(args)...);
+	}
+};
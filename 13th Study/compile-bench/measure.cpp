@@ -0,0 +1,44 @@
+// measure <command> [args...]
+// runs the command and prints its wall-clock time and peak resident memory
+// ("MEASURE <seconds> <kilobytes> <exit code>") on stdout; the output of the
+// command itself is passed through unchanged
+#include <chrono>
+#include <cstdio>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) {
+		std::fprintf(stderr, "usage: %s command [args...]\n", argv[0]);
+		return 2;
+	}
+	auto start = std::chrono::steady_clock::now();
+	pid_t pid = fork();
+	if (pid < 0) {
+		std::perror("fork");
+		return 2;
+	}
+	if (pid == 0) {
+		execvp(argv[1], argv + 1);
+		std::perror(argv[1]);
+		_exit(127);
+	}
+	int status = 0;
+	rusage usage{};
+	if (wait4(pid, &status, 0, &usage) < 0) {
+		std::perror("wait4");
+		return 2;
+	}
+	std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+	int code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+	// ru_maxrss is in kilobytes on Linux (bytes on macOS)
+#ifdef __APPLE__
+	long rssKb = usage.ru_maxrss / 1024;
+#else
+	long rssKb = usage.ru_maxrss;
+#endif
+	std::printf("MEASURE %.3f %ld %d\n", wall.count(), rssKb, code);
+	return code;
+}
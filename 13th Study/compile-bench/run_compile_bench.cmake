@@ -0,0 +1,75 @@
+# cmake -DMEASURE=... -DCOMPILER=... -DCOMPILER_ID=... -DFLAGS=... -DMANIFEST=...
+#       -DOUTPUT_DIR=... -P run_compile_bench.cmake
+# compiles every unit listed in MANIFEST and writes compile_bench.md and
+# compile_bench.json with wall-clock time and peak memory per unit;
+# the compiler memory column (GGC memory of -ftime-report) is GCC only and
+# n/a/null for other compilers
+
+SEPARATE_ARGUMENTS(FLAG_LIST UNIX_COMMAND "${FLAGS}")
+SET(REPORT_FLAG "")
+IF(COMPILER_ID STREQUAL "GNU")
+  SET(REPORT_FLAG -ftime-report)     # printed to stderr, TOTAL line parsed below
+ENDIF()
+
+FILE(STRINGS ${MANIFEST} UNITS)
+SET(TABLE "| metaprogram | N | compile [s] | peak RSS [MB] | compiler memory [MB] |\n")
+STRING(APPEND TABLE "|---|---:|---:|---:|---:|\n")
+SET(JSON "[\n")
+SET(SEPARATOR "")
+FOREACH(UNIT IN LISTS UNITS)
+  STRING(REPLACE "|" ";" FIELDS "${UNIT}")
+  LIST(GET FIELDS 0 NAME)
+  LIST(GET FIELDS 1 N)
+  LIST(GET FIELDS 2 SOURCE)
+  LIST(GET FIELDS 3 INCLUDE_DIR)
+  GET_FILENAME_COMPONENT(STEM ${SOURCE} NAME_WE)
+  SET(OBJECT ${OUTPUT_DIR}/units/${STEM}.o)
+
+  EXECUTE_PROCESS(
+    COMMAND ${MEASURE} ${COMPILER} ${FLAG_LIST} ${REPORT_FLAG} -I${INCLUDE_DIR}
+            -c ${SOURCE} -o ${OBJECT}
+    OUTPUT_VARIABLE OUT
+    ERROR_VARIABLE ERR
+    RESULT_VARIABLE RC)
+
+  SET(SECONDS "n/a")
+  SET(RSS_MB "n/a")
+  SET(GGC_MB "n/a")
+  IF(OUT MATCHES "MEASURE ([0-9.]+) ([0-9]+) ([0-9]+)")
+    SET(SECONDS ${CMAKE_MATCH_1})
+    MATH(EXPR RSS_MB "${CMAKE_MATCH_2} / 1024")
+  ENDIF()
+  # GCC: garbage-collected memory allocated by the compiler, in k or M
+  IF(ERR MATCHES "TOTAL[ \t]*:[ \t]*[0-9.]+[ \t]+[0-9.]+[ \t]+[0-9.]+[ \t]+([0-9]+)([kM])")
+    IF(CMAKE_MATCH_2 STREQUAL "M")
+      SET(GGC_MB ${CMAKE_MATCH_1})
+    ELSE()
+      MATH(EXPR GGC_MB "${CMAKE_MATCH_1} / 1024")
+    ENDIF()
+  ENDIF()
+  IF(NOT RC EQUAL 0)
+    SET(SECONDS "failed")
+    STRING(REGEX REPLACE "\n.*" "" FIRST_ERROR "${ERR}")
+    MESSAGE(WARNING "${NAME} N=${N} failed: ${FIRST_ERROR}")
+  ENDIF()
+  MESSAGE(STATUS "${NAME} N=${N}: ${SECONDS} s, ${RSS_MB} MB")
+
+  STRING(APPEND TABLE "| ${NAME} | ${N} | ${SECONDS} | ${RSS_MB} | ${GGC_MB} |\n")
+  FOREACH(VALUE SECONDS RSS_MB GGC_MB)   # numbers, or null if not measured
+    IF(${VALUE} MATCHES "^[0-9.]+$")
+      SET(JSON_${VALUE} ${${VALUE}})
+    ELSE()
+      SET(JSON_${VALUE} null)
+    ENDIF()
+  ENDFOREACH()
+  STRING(APPEND JSON "${SEPARATOR}  {\"metaprogram\": \"${NAME}\", \"n\": ${N}, "
+    "\"seconds\": ${JSON_SECONDS}, \"peak_rss_mb\": ${JSON_RSS_MB}, "
+    "\"compiler_memory_mb\": ${JSON_GGC_MB}}")
+  SET(SEPARATOR ",\n")
+ENDFOREACH()
+STRING(APPEND JSON "\n]\n")
+
+FILE(WRITE ${OUTPUT_DIR}/compile_bench.md "${TABLE}")
+FILE(WRITE ${OUTPUT_DIR}/compile_bench.json "${JSON}")
+MESSAGE("\n${TABLE}")
+MESSAGE("written to ${OUTPUT_DIR}/compile_bench.md and compile_bench.json")
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// the recursive version of section 23.1.3 (one instantiation per element)
+template<typename T, std::size_t N>
+struct DotProductT {
+	static inline T result(T const* a, T const* b) {
+		return *a * *b + DotProductT<T, N - 1>::result(a + 1, b + 1);
+	}
+};
+// partial specialization as end criteria
+template<typename T>
+struct DotProductT<T, 0> {
+	static inline T result(T const*, T const*) {
+		return T{};
+	}
+};
+
+template<typename T, std::size_t N>
+auto dotProduct(std::array<T, N> const& x, std::array<T, N> const& y)
+{
+	return DotProductT<T, N>::result(x.data(), y.data());
+}
+
+// dot_product(): the code is selected at compile time from N and T only,
+// and every variant is constexpr:
+// - up to dotProductUnrollLimit elements the sum is expanded completely
+//   (one fold expression instead of N recursive instantiations)
+// - larger arrays of arithmetic types are summed in blocks of dotProductLanes
+//   independent partial sums, which the compiler keeps in SIMD registers
+//   (for floating-point types this reorders the additions); other types
+//   use a plain loop
+inline constexpr std::size_t dotProductUnrollLimit = 16;
+
+// 64 bytes of partial sums (e.g. four SSE or two AVX registers), but fewer
+// for short arrays, which would otherwise be dominated by adding the lanes;
+// a power of two (dotProductReduce halves the lanes) and at least one, also
+// for sizes like 12 (i386 long double) or more than 64 bytes
+template<typename T, std::size_t N>
+inline constexpr std::size_t dotProductLanes
+	= std::bit_floor(std::max<std::size_t>(1, std::min(64 / sizeof(T), N / 2)));
+
+template<typename T, std::size_t N, std::size_t... I>
+constexpr T dotProductUnrolled(T const* x, T const* y, std::index_sequence<I...>)
+{
+	return (T{} + ... + (x[I] * y[I]));
+}
+
+// one block: lane l accumulates element l (expanded, like everything below,
+// so that the lanes can live in registers instead of memory)
+template<typename T, std::size_t... L>
+constexpr void dotProductBlock([[maybe_unused]] T* lanes, [[maybe_unused]] T const* x,
+	[[maybe_unused]] T const* y, std::index_sequence<L...>)
+{
+	((lanes[L] += x[L] * y[L]), ...);
+}
+
+// add the upper half of the first 2 * Width lanes to the lower half, until one is left
+template<std::size_t Width, typename T, std::size_t... L>
+constexpr T dotProductReduce(T* lanes, std::index_sequence<L...>)
+{
+	((lanes[L] += lanes[L + Width]), ...);
+	if constexpr (Width == 1) {
+		return lanes[0];
+	}
+	else {
+		return dotProductReduce<Width / 2>(lanes, std::make_index_sequence<Width / 2>{});
+	}
+}
+
+template<typename T, std::size_t N>
+constexpr T dotProductBlocked(T const* x, T const* y)
+{
+	constexpr std::size_t L = dotProductLanes<T, N>;
+	constexpr std::size_t blocked = N / L * L;
+	T lanes[L]{};
+	for (std::size_t k = 0; k < blocked; k += L) {
+		dotProductBlock(lanes, x + k, y + k, std::make_index_sequence<L>{});
+	}
+	// remaining elements
+	dotProductBlock(lanes, x + blocked, y + blocked, std::make_index_sequence<N - blocked>{});
+	return dotProductReduce<L / 2>(lanes, std::make_index_sequence<L / 2>{});
+}
+
+template<typename T, std::size_t N>
+constexpr T dot_product(std::array<T, N> const& x, std::array<T, N> const& y)
+{
+	if constexpr (N <= dotProductUnrollLimit) {
+		return dotProductUnrolled<T, N>(x.data(), y.data(), std::make_index_sequence<N>{});
+	}
+	else if constexpr (std::is_arithmetic_v<T>) {
+		return dotProductBlocked<T, N>(x.data(), y.data());
+	}
+	else {
+		T result{};
+		for (std::size_t k = 0; k < N; ++k) {
+			result += x[k] * y[k];
+		}
+		return result;
+	}
+}
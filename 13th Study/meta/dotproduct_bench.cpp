@@ -0,0 +1,93 @@
+// DotProductT<T, 4096> instantiates 4096 levels of recursion, so build with
+// g++ -std=c++20 -O2 -ftemplate-depth=4200 dotproduct_bench.cpp
+#include "dotproduct.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+// the plain loop of section 23.1.3
+template<typename T, std::size_t N>
+auto dotProductLoop(std::array<T, N> const& x, std::array<T, N> const& y)
+{
+	T result{};
+	for (std::size_t k = 0; k < N; ++k) {
+		result += x[k] * y[k];
+	}
+	return result;
+}
+
+constexpr std::array<int, 3> a{1, 2, 3};
+constexpr std::array<int, 3> b{4, 5, 6};
+static_assert(dot_product(a, b) == 32);
+
+constexpr std::array<double, 100> ones = [] {
+	std::array<double, 100> r{};
+	for (auto& v : r) {
+		v = 1.0;
+	}
+	return r;
+}();
+static_assert(dot_product(ones, ones) == 100.0);	// blocked variant at compile time
+// lanes are a power of two even if 64 / sizeof(T) is not
+struct alignas(4) Bytes12 {
+	char bytes[12];
+};
+static_assert(dotProductLanes<Bytes12, 100> == 4 && dotProductLanes<double, 100> == 8);
+
+template<typename T, std::size_t N, typename F>
+double measure(std::vector<std::array<T, N>> const& xs, std::vector<std::array<T, N>> const& ys,
+	long calls, F dot)
+{
+	T sum{};
+	auto start = std::chrono::steady_clock::now();
+	for (long c = 0; c < calls; ++c) {
+		std::size_t i = static_cast<std::size_t>(c) % xs.size();
+		sum += dot(xs[i], ys[i]);
+	}
+	std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+	if (sum == T{42}) {				// keep the loop from being optimized away
+		std::cout << ' ';
+	}
+	return d.count() / calls * 1e9;
+}
+
+template<typename T, std::size_t N>
+void measureAll()
+{
+	constexpr std::size_t pool = 8;	// a few different arrays, all in the cache
+	std::vector<std::array<T, N>> xs(pool), ys(pool);
+	for (std::size_t i = 0; i < pool; ++i) {
+		for (std::size_t k = 0; k < N; ++k) {
+			xs[i][k] = static_cast<T>((i + k) % 7);
+			ys[i][k] = static_cast<T>((i * k) % 5);
+		}
+	}
+	long calls = 200'000'000 / static_cast<long>(N + 8);
+	double recursive = measure(xs, ys, calls, [](auto const& x, auto const& y) {
+		return dotProduct(x, y);
+	});
+	double loop = measure(xs, ys, calls, [](auto const& x, auto const& y) {
+		return dotProductLoop(x, y);
+	});
+	double blocked = measure(xs, ys, calls, [](auto const& x, auto const& y) {
+		return dot_product(x, y);
+	});
+	std::cout << "N = " << N << ": DotProductT " << recursive << " ns, loop " << loop
+		<< " ns, dot_product " << blocked << " ns\n";
+}
+
+template<typename T, std::size_t... Ns>
+void measureSizes(char const* name)
+{
+	std::cout << name << ":\n";
+	(measureAll<T, Ns>(), ...);
+}
+
+int main()
+{
+	measureSizes<double, 3, 4, 8, 16, 17, 64, 256, 1024, 4096>("double");
+	measureSizes<float, 3, 4, 8, 16, 17, 64, 256, 1024, 4096>("float");
+	measureSizes<int, 3, 4, 8, 16, 17, 64, 256, 1024, 4096>("int");
+}
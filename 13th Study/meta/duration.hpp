@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include "ratio.hpp"
+
+// Duration<T, U> of section 23.1.4: a value of type T counting units of U
+// seconds; the unit lives only in the type, so a Duration has exactly the
+// size and layout of T and arrays of Durations are arrays of T
+template<typename T, typename U = Ratio<1>>
+class Duration {
+public:
+	using ValueType = T;
+	using UnitType = typename U::Type;
+private:
+	ValueType val;
+public:
+	constexpr Duration(ValueType v = 0)
+		: val(v) {
+	}
+	constexpr ValueType value() const {
+		return val;
+	}
+};
+
+template<typename T>
+struct IsDurationT : std::false_type {
+};
+template<typename T, typename U>
+struct IsDurationT<Duration<T, U>> : std::true_type {
+};
+
+// multiply v by the compile-time Factor (a Ratio in lowest terms) with as few
+// run-time operations as possible: nothing, one multiplication or division
+// by a constant, or (integral types with a proper fraction) both
+template<typename Factor, typename T>
+constexpr T scaleBy(T v)
+{
+	if constexpr (Factor::num == 1 && Factor::den == 1) {
+		return v;
+	}
+	else if constexpr (std::is_floating_point_v<T>) {
+		// may differ from v * num / den in the last bit
+		constexpr T factor = static_cast<T>(Factor::num) / static_cast<T>(Factor::den);
+		return v * factor;
+	}
+	else if constexpr (Factor::den == 1) {
+		return v * static_cast<T>(Factor::num);
+	}
+	else if constexpr (Factor::num == 1) {
+		return v / static_cast<T>(Factor::den);
+	}
+	else {
+		return v * static_cast<T>(Factor::num) / static_cast<T>(Factor::den);
+	}
+}
+
+// convert d to the unit (and value type) of ToDuration
+template<typename ToDuration, typename T, typename U>
+constexpr ToDuration durationCast(Duration<T, U> const& d)
+{
+	using ToT = typename ToDuration::ValueType;
+	using C = std::common_type_t<T, ToT>;
+	using Factor = RatioDivide<U, typename ToDuration::UnitType>;
+	return ToDuration(static_cast<ToT>(scaleBy<Factor>(static_cast<C>(d.value()))));
+}
+
+template<typename T1, typename U1, typename T2, typename U2>
+auto constexpr operator+(Duration<T1, U1> const& lhs,
+	Duration<T2, U2> const& rhs)
+{
+	// resulting type is the largest unit both unit types are multiples of
+	// (so integral values stay exact), computed and reduced at compile time
+	using VT = RatioCommon<U1, U2>;
+	using C = std::common_type_t<T1, T2>;
+	// resulting value is the sum of both values
+	// converted to the resulting unit type:
+	auto val = scaleBy<RatioDivide<U1, VT>>(static_cast<C>(lhs.value()))
+		+ scaleBy<RatioDivide<U2, VT>>(static_cast<C>(rhs.value()));
+	return Duration<decltype(val), VT>(val);
+}
+
+template<typename T1, typename U1, typename T2, typename U2>
+auto constexpr operator-(Duration<T1, U1> const& lhs,
+	Duration<T2, U2> const& rhs)
+{
+	// like operator+, without negating rhs (which wraps for unsigned T2)
+	using VT = RatioCommon<U1, U2>;
+	using C = std::common_type_t<T1, T2>;
+	auto val = scaleBy<RatioDivide<U1, VT>>(static_cast<C>(lhs.value()))
+		- scaleBy<RatioDivide<U2, VT>>(static_cast<C>(rhs.value()));
+	return Duration<decltype(val), VT>(val);
+}
+
+// batch operations over contiguous ranges (vector, array, span of any
+// extent); the unit conversions are resolved at compile time, so each loop
+// does per element exactly what a loop over raw values with the constant
+// factors would do
+
+// out[i] = durationCast<To>(in[i])
+template<std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+constexpr void durationCast(In&& in, Out&& out)
+{
+	using From = std::ranges::range_value_t<In>;
+	using To = std::ranges::range_value_t<Out>;
+	static_assert(IsDurationT<From>::value && IsDurationT<To>::value);
+	auto src = std::ranges::data(in);
+	auto dst = std::ranges::data(out);
+	std::size_t n = std::min<std::size_t>(std::ranges::size(in), std::ranges::size(out));
+	for (std::size_t i = 0; i < n; ++i) {
+		dst[i] = durationCast<To>(src[i]);
+	}
+}
+
+// out[i] = durationCast<Out>(lhs[i] + rhs[i]): the values are added exactly
+// in the common unit of lhs and rhs and converted into the unit of Out once,
+// so an integral Out coarser than the inputs is not truncated twice
+template<std::ranges::contiguous_range L, std::ranges::contiguous_range R,
+	std::ranges::contiguous_range Out>
+constexpr void durationAdd(L&& lhs, R&& rhs, Out&& out)
+{
+	using LD = std::ranges::range_value_t<L>;
+	using RD = std::ranges::range_value_t<R>;
+	using OD = std::ranges::range_value_t<Out>;
+	static_assert(IsDurationT<LD>::value && IsDurationT<RD>::value && IsDurationT<OD>::value);
+	using T = typename OD::ValueType;
+	using C = std::common_type_t<typename LD::ValueType, typename RD::ValueType, T>;
+	using VT = RatioCommon<typename LD::UnitType, typename RD::UnitType>;
+	using LFactor = RatioDivide<typename LD::UnitType, VT>;
+	using RFactor = RatioDivide<typename RD::UnitType, VT>;
+	using OutFactor = RatioDivide<VT, typename OD::UnitType>;
+	auto l = std::ranges::data(lhs);
+	auto r = std::ranges::data(rhs);
+	auto dst = std::ranges::data(out);
+	std::size_t n = std::min({std::size_t(std::ranges::size(lhs)),
+		std::size_t(std::ranges::size(rhs)), std::size_t(std::ranges::size(out))});
+	for (std::size_t i = 0; i < n; ++i) {
+		C sum = scaleBy<LFactor>(static_cast<C>(l[i].value()))
+			+ scaleBy<RFactor>(static_cast<C>(r[i].value()));
+		dst[i] = OD(static_cast<T>(scaleBy<OutFactor>(sum)));
+	}
+}
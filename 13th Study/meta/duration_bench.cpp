@@ -0,0 +1,139 @@
+#include "duration.hpp"
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using Milliseconds = Duration<double, Ratio<1, 1000>>;
+using Seconds = Duration<double>;
+using TwoThirds = Duration<double, Ratio<2, 3>>;
+using Microseconds = Duration<long long, Ratio<1, 1000000>>;
+using MillisecondsI = Duration<long long, Ratio<1, 1000>>;
+
+// ratio simplification and unit selection happen at compile time:
+static_assert(std::is_same_v<RatioAdd<Ratio<1, 1000>, Ratio<2, 3>>, Ratio<2003, 3000>>);
+static_assert(std::is_same_v<RatioAdd<Ratio<1, 6>, Ratio<1, 3>>, Ratio<1, 2>>);
+static_assert(std::is_same_v<Ratio<2, 2000>::Type, Ratio<1, 1000>>);
+static_assert(std::is_same_v<RatioCommon<Ratio<1, 1000>, Ratio<2, 3>>, Ratio<1, 3000>>);
+static_assert(std::is_same_v<RatioDivide<Ratio<1, 1000>, Ratio<1>>, Ratio<1, 1000>>);
+static_assert((Duration<int, Ratio<1, 1000>>(42) + Duration<int, Ratio<2, 3>>(77)).value()
+	== 42 * 3 + 77 * 2000);
+static_assert(durationCast<MillisecondsI>(Microseconds(123456)).value() == 123);
+// batch add: summed in the common unit, converted once (999ms + 999ms = 1s)
+static_assert([] {
+	using SecondsI = Duration<long long>;
+	MillisecondsI lhs[] = {999, 1500, -999};
+	std::vector<MillisecondsI> rhs = {999, 499, -999};
+	std::array<SecondsI, 3> out{};
+	durationAdd(lhs, rhs, std::span(out));
+	return out[0].value() == 1 && out[1].value() == 1 && out[2].value() == -1
+		&& out[0].value() == durationCast<SecondsI>(lhs[0] + rhs[0]).value();
+}());
+static_assert([] {
+	std::array<Microseconds, 2> in = {Microseconds(123456), Microseconds(999)};
+	std::array<MillisecondsI, 2> out{};
+	durationCast(std::span(in), std::span(out));   // static extent
+	return out[0].value() == 123 && out[1].value() == 0;
+}());
+// no space or layout overhead over raw values:
+static_assert(sizeof(Milliseconds) == sizeof(double) && std::is_trivially_copyable_v<Milliseconds>);
+
+template<typename F>
+double seconds(F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+	return d.count();
+}
+
+// run the raw and the unit-typed version of one batch operation on n samples
+// (one after the other, to keep the memory needed down) and compare results
+template<typename Raw, typename Typed>
+void compare(char const* name, std::size_t n, Raw raw, Typed typed)
+{
+	double rawSum = 0, typedSum = 0;
+	double rawTime = raw(n, rawSum);
+	double typedTime = typed(n, typedSum);
+	std::cout << name << ": raw " << n / rawTime / 1e6 << " M/s, unit-typed "
+		<< n / typedTime / 1e6 << " M/s" << (rawSum == typedSum ? "" : " MISMATCH") << '\n';
+}
+
+int main(int argc, char* argv[])
+{
+	auto a = Duration<int, Ratio<1, 1000>>(42);	// 42 milliseconds
+	auto b = Duration<int, Ratio<2, 3>>(77);	// 77 2/3 seconds
+	auto c = a + b;	// unit 1/3000 seconds, computed as a*3 + b*2000
+	using CT = decltype(c)::UnitType;
+	std::cout << c.value() << " * " << CT::num << '/' << CT::den << " s\n";
+
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100'000'000;
+
+	compare("ms -> s (double)          ", n,
+		[](std::size_t n, double& sum) {
+			std::vector<double> in(n, 1500.0), out(n);
+			double t = seconds([&] {
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = in[i] * (1.0 / 1000);
+				}
+			});
+			sum = out[n / 2];
+			return t;
+		},
+		[](std::size_t n, double& sum) {
+			std::vector<Milliseconds> in(n, Milliseconds(1500.0));
+			std::vector<Seconds> out(n);
+			double t = seconds([&] {
+				durationCast(std::span(in), std::span(out));
+			});
+			sum = out[n / 2].value();
+			return t;
+		});
+
+	compare("us -> ms (long long)      ", n,
+		[](std::size_t n, double& sum) {
+			std::vector<long long> in(n, 1234567), out(n);
+			double t = seconds([&] {
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = in[i] / 1000;
+				}
+			});
+			sum = static_cast<double>(out[n / 2]);
+			return t;
+		},
+		[](std::size_t n, double& sum) {
+			std::vector<Microseconds> in(n, Microseconds(1234567));
+			std::vector<MillisecondsI> out(n);
+			double t = seconds([&] {
+				durationCast(std::span(in), std::span(out));
+			});
+			sum = static_cast<double>(out[n / 2].value());
+			return t;
+		});
+
+	compare("ms + 2/3 s -> 1/3000 s    ", n,
+		[](std::size_t n, double& sum) {
+			std::vector<double> lhs(n, 42.0), rhs(n, 77.0), out(n);
+			double t = seconds([&] {
+				for (std::size_t i = 0; i < n; ++i) {
+					out[i] = lhs[i] * 3.0 + rhs[i] * 2000.0;
+				}
+			});
+			sum = out[n / 2];
+			return t;
+		},
+		[](std::size_t n, double& sum) {
+			using Out = Duration<double, RatioCommon<Ratio<1, 1000>, Ratio<2, 3>>>;
+			std::vector<Milliseconds> lhs(n, Milliseconds(42.0));
+			std::vector<TwoThirds> rhs(n, TwoThirds(77.0));
+			std::vector<Out> out(n);
+			double t = seconds([&] {
+				durationAdd(lhs, rhs, out);
+			});
+			sum = out[n / 2].value();
+			return t;
+		});
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <numeric>	// for std::gcd() and std::lcm()
+
+// Ratio<N, D> of section 23.1.4; Type is the ratio in lowest terms, so that
+// equal fractions (e.g. Ratio<2, 2000> and Ratio<1, 1000>) share one unit type
+template<unsigned N, unsigned D = 1>
+struct Ratio {
+	static_assert(D != 0, "denominator must not be zero");
+	static constexpr unsigned num = N; // numerator
+	static constexpr unsigned den = D; // denominator
+	using Type = Ratio<num / std::gcd(num, den), den / std::gcd(num, den)>;
+};
+
+// computes in unsigned long long and checks that the result fits a Ratio
+template<unsigned long long N, unsigned long long D>
+struct RatioReduceT
+{
+private:
+	static constexpr unsigned long long g = std::gcd(N, D);
+	static_assert(N / g <= ~0u && D / g <= ~0u, "ratio overflows unsigned");
+public:
+	using Type = Ratio<static_cast<unsigned>(N / g), static_cast<unsigned>(D / g)>;
+};
+
+template<typename R1, typename R2>
+struct RatioAddImpl
+{
+private:
+	static constexpr unsigned long long den = 1ull * R1::den * R2::den;
+	static constexpr unsigned long long num = 1ull * R1::num * R2::den + 1ull * R2::num * R1::den;
+public:
+	using Type = typename RatioReduceT<num, den>::Type;
+};
+// using declaration for convenient usage:
+template<typename R1, typename R2>
+using RatioAdd = typename RatioAddImpl<R1, R2>::Type;
+
+// R1 / R2: the factor converting a count of R1 units into R2 units
+template<typename R1, typename R2>
+using RatioDivide = typename RatioReduceT<1ull * R1::num * R2::den,
+	1ull * R1::den * R2::num>::Type;
+
+// the largest unit both R1 and R2 are integral multiples of
+// (gcd of the numerators over lcm of the denominators, as std::chrono does)
+template<typename R1, typename R2>
+using RatioCommon = typename RatioReduceT<
+	std::gcd(R1::Type::num, R2::Type::num),
+	std::lcm(1ull * R1::Type::den, 1ull * R2::Type::den)>::Type;
@@ -31,6 +31,16 @@ public:
         return *this;
     };
 
+    // EVALUATES AN EXPRESSION, ELEMENT BY ELEMENT
+    template <typename T2, typename Data2>
+    Array& operator=(const Array<T2, Data2> &obj)
+    {
+        assert(size() == obj.size());
+        for (size_t i = 0; i < size(); ++i)
+            data_[i] = obj[i];
+        return *this;
+    };
+
     /* ----------------------------------------------------------
         ACCESSORS
     ---------------------------------------------------------- */
@@ -48,12 +58,13 @@ public:
         return data_;
     };
 
-    inline T& operator[](size_t index)
+    // T& FOR STORED ARRAYS, A COMPUTED T FOR EXPRESSIONS
+    inline decltype(auto) operator[](size_t index)
     {
         assert(index < size());
         return data_[index];
     };
-    inline const T& operator[](size_t index) const
+    inline decltype(auto) operator[](size_t index) const
     {
         assert(index < size());
         return data_[index];
@@ -2,6 +2,8 @@
 #include <cassert>
 #include <cstddef>
 
+#include "../../../11th Study/policy-traits/read-only-param.hpp"
+
 template <typename T>
 class SArray
 {
@@ -22,14 +24,28 @@ public:
     };
 
     // COPY CONSTRUCTOR
+    SArray(const SArray<T> &obj)
+        : data_(new T[obj.size()]),
+        size_(obj.size())
+    {
+        copy(obj);
+    };
+
     template <typename X>
     SArray(const SArray<X> &obj)
-        : data_(new T[size]),
-        size_(size)
+        : data_(new T[obj.size()]),
+        size_(obj.size())
     {
         copy(obj);
     };
 
+    SArray<T>& operator=(const SArray<T> &obj)
+    {
+        if (&obj != this)
+            copy(obj);
+        return *this;
+    };
+
     template <typename X>
     SArray<T>& operator=(const SArray<X> &obj)
     {
@@ -51,7 +67,7 @@ protected:
     };
 
     template <typename X>
-    void copy(SArray<X> &obj)
+    void copy(const SArray<X> &obj)
     {
         assert(size() == obj.size());
         for (size_t i = 0; i < size(); ++i)
@@ -97,10 +113,9 @@ public:
         return *this;
     };
 
-    template <typename X>
-    SArray<T>& operator*=(const T &val)
+    SArray<T>& operator*=(read_only_param_t<T> val)
     {
-        for (size_t i = 0; i < a.size(); ++i)
+        for (size_t i = 0; i < size(); ++i)
             data_[i] *= val;
         return *this;
     };
@@ -22,12 +22,15 @@ void s_array()
         x.data()
     );
     auto arr = Array<int, A_Mult<int, A_Scalar<int>, SArray<int>>>(op);
+    for (size_t i = 0; i < arr.size(); ++i)
+        cout << arr[i] << endl;     // 4*x, EVALUATED ELEMENT BY ELEMENT
 
-    // auto ret = 2*x + x*y; //--> ??
-    auto ret = x + x*y;
+    // SCALARS AND SUB-EXPRESSIONS ARE HELD BY VALUE, ARRAYS BY REFERENCE:
+    // AN EXPRESSION STAYS VALID AS LONG AS x AND y LIVE
+    Array<int> ret(5);
+    ret = 2*x + x*y;
     for (size_t i = 0; i < ret.size(); ++i)
-        // cout << ret[i] << endl; //--> ???
-        cout << ret.data()[i] << endl;
+        cout << ret[i] << endl;
 }
 
 int main()
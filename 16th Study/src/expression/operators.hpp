@@ -1,6 +1,9 @@
 #pragma once
 #include <cassert>
-#include <numeric>
+#include <cstddef>
+#include <functional>
+
+#include "../../../11th Study/policy-traits/read-only-param.hpp"
 
 /* ----------------------------------------------------------
     TRAITS
@@ -16,10 +19,10 @@ template<typename T>
 class A_Scalar
 {
 private:
-    const T &s;
+    T s; // a copy: the scalar is often a temporary
 
 public:
-    constexpr A_Scalar(const T &v)
+    constexpr A_Scalar(read_only_param_t<T> v)
         : s(v)
     {
     };
@@ -69,4 +72,22 @@ template <typename T, typename X, typename Y>
 using A_Add = A_Operator<T, X, Y, std::plus<T>>;
 
 template <typename T, typename X, typename Y>
-using A_Mult = A_Operator<T, X, Y, std::multiplies<T>>;
\ No newline at end of file
+using A_Mult = A_Operator<T, X, Y, std::multiplies<T>>;
+
+/* ----------------------------------------------------------
+    TRAITS FOR TEMPORARIES
+---------------------------------------------------------- */
+// SCALARS AND (SUB-)EXPRESSIONS ARE SMALL TEMPORARIES: KEEP THEM BY VALUE
+template <typename T>
+class A_Traits<A_Scalar<T>>
+{
+public:
+    using Reference = A_Scalar<T>;
+};
+
+template <typename T, typename X, typename Y, typename Operator>
+class A_Traits<A_Operator<T, X, Y, Operator>>
+{
+public:
+    using Reference = A_Operator<T, X, Y, Operator>;
+};
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "VariantGetter.hpp"
 
 #include "functional.hpp"
+#include "../../../11th Study/policy-traits/read-only-param.hpp"
 #include <exception>
+#include <stdexcept>
 
 #include <iostream>
 #include <typeinfo>
@@ -23,9 +25,19 @@ public:
     Variant()
         : index_(0) {};
 
+    // small trivially copyable alternatives by value, the others by reference
     template <typename T>
+        requires std::is_same_v<read_only_param_t<T>, T>
+    Variant(T val)
+        : data_(val),
+        index_(FindIndexOfT<TypeList<Types...>, T>::value)
+    {
+    };
+
+    template <typename T>
+        requires (!std::is_same_v<read_only_param_t<T>, T>)
     Variant(const T &val)
-        : data_(val), 
+        : data_(val),
         index_(FindIndexOfT<TypeList<Types...>, T>::value)
     {
     };
@@ -41,14 +53,14 @@ public:
     };
     
     template <typename T>
-    auto get()
+    auto get() const
     {
         constexpr size_t N = FindIndexOfT<TypeList<Types...>, T>::value;
         return get<N>();
     };
 
     template <size_t N>
-    auto get()
+    auto get() const
     {
         return VariantGetter<N>::apply(data_);
     };
@@ -56,7 +68,7 @@ public:
     template <typename Func>
     void visit(Func &&func) const
     {
-        if (index_ == -1)
+        if (index_ == static_cast<size_t>(-1))
             throw std::invalid_argument("value is not assigned.");
 
         _Visit<Func, Types...>(&func);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../../../11th Study/policy-traits/read-only-param.hpp"
+
 template <typename ...Types>
 union VariantStorage;
 
@@ -12,7 +14,7 @@ public:
 
 public:
     VariantStorage() {};
-    VariantStorage(const Head &head)
+    VariantStorage(read_only_param_t<Head> head)
         : head_(head) {};
 
     template <typename T>
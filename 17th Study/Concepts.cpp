@@ -1,36 +1,16 @@
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <locale>
 #include <vector>
 #include <cassert>
 #include <list>
 
+#include "pretty_print.hpp"
+
 using namespace std::literals;
 using namespace std;
 
-// Declaration of the concept "EqualityComparable",
-// which is satisfied by any type T such that for values a and b of type T
-// the expression a == b compiles and its result is convertible to bool
-template <typename T>
-concept bool EqualityComparable = requires(T a, T b)
-{
-    { a == b } -> bool;
-};
-
-// Forces you to implement to_string method
-template <typename T>
-concept bool Stringable = requires(T a)
-{
-    { a.to_string() }->string;
-};
-
-// Has a to_string function which returns a string
-template <typename T>
-concept bool HasStringFunc = requires(T a)
-{
-    { to_string(a) }->string;
-};
-
 struct Person
 {
     double height;
@@ -42,50 +22,29 @@ struct Person
         weight = b;
     }
 
-    string to_string()
+    string to_string() const
     {
-        return "Weight: " + std::to_string(height) + " Height: " + std::to_string(weight);
+        return "Height: " + std::to_string(height) + " Weight: " + std::to_string(weight);
     }
 };
 
-namespace std
-{
-    string to_string(list<int> l)
-    {
-        // Better ways to do this but just as example
-        string s = "";
-
-        for (int a : l)
-        {
-            s += (" " + to_string(a) + " ");
-        }
-
-        return s;
-    }
-}
-
-string to_string(std::vector<int> v)
+// opts into the write_to() hook: printed without any temporary string
+struct Point
 {
-    string s = "";
+    int x;
+    int y;
 
-    for (int a : v)
+    template <typename Out>
+    Out write_to(Out out) const
     {
-        s += (" " + to_string(a) + " ");
+        *out++ = '(';
+        out = write_pretty(out, x);
+        *out++ = ',';
+        out = write_pretty(out, y);
+        *out++ = ')';
+        return out;
     }
-
-    return s;
-}
-
-void pretty_print(Stringable a)
-{
-    // We know that if the compiler made it this far we are good to go.
-    cout << a.to_string() << endl;
-}
-
-void pretty_print(HasStringFunc a)
-{
-    cout << to_string(a) << endl;
-}
+};
 
 // declaration of a constrained function template
 // template<typename T>
@@ -93,26 +52,31 @@ void pretty_print(HasStringFunc a)
 
 int main()
 {
-    assert(__cpp_concepts >= 201500); // check compiled with -fconcepts
-    assert(__cplusplus >= 201500);    // check compiled with --std=c++1z
+    static_assert(__cpp_concepts >= 201907L); // check compiled with C++20 concepts
+    static_assert(__cplusplus >= 202002L);    // check compiled with --std=c++20
 
     std::list<int> l{ 1, 2, 3 };
     Person jonathan(5.7, 130);
     std::vector<int> v{ 34, 23, 34, 56, 78 };
+    std::vector<Point> points{ { 1, 2 }, { 3, 4 } };
 
-    // we can make it possible to pretty print a
-    // vector we just need to implement -> string to_string(vector<int> a);
-    // If we want to pretty print
-    pretty_print(jonathan); // uses concept overload pretty_print(Stringable a)
-    pretty_print(3);        // uses concept overload pretty_print(HasStringFunc a) 
-    pretty_print(l);
-
+    // lists and vectors satisfy Range, so they need no to_string() of their own
+    pretty_print(jonathan); // Stringable: to_string()
+    pretty_print(3);        // Arithmetic: std::to_chars, no string
+    pretty_print(l);        // Range
     pretty_print(v);
-    // This will result in an error, first you get the old template garbage you are used to
-    // but you can ignore that because at the end highlighted in blue you will see
-    // main.cpp:41:6: note:   constraints not satisfied
-    // void pretty_print(Stringable a)
-    // ^~~~~~~~~~~~
-    // main.cpp:18:14: note: within template<class T> concept const bool Stringable<T> [with T = std::vector<std::__cxx11::basic_string<char> >]
-    // concept bool Stringable = requires(T a)
-}
\ No newline at end of file
+    pretty_print(points);   // Range of Writable: write_to()
+    pretty_print("hi"s);    // StringLike: verbatim, not char by char
+    pretty_print("hi");     // string literal: without its terminating null
+    pretty_print(std::vector<std::string>{ "a", "bc" }); // Range of StringLike
+
+    // or into any output iterator, e.g. a caller-provided buffer
+    char buffer[64];
+    char* end = write_pretty(buffer, v);
+    cout << string_view(buffer, end - buffer) << endl;
+
+    // This will result in an error, a vector of vectors is not Printable
+    // (elements of a Range must be printable without recursion):
+    // pretty_print(std::vector<std::vector<int>>{ { 1 } });
+    // note: constraints not satisfied
+}
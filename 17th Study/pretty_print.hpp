@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Declaration of the concept "EqualityComparable",
+// which is satisfied by any type T such that for values a and b of type T
+// the expression a == b compiles and its result is convertible to bool
+template <typename T>
+concept EqualityComparable = requires(T a, T b)
+{
+    { a == b } -> std::convertible_to<bool>;
+};
+
+// Forces you to implement to_string method
+template <typename T>
+concept Stringable = requires(T const& a)
+{
+    { a.to_string() } -> std::convertible_to<std::string>;
+};
+
+// Has a to_string function (found by ADL) which returns a string
+template <typename T>
+concept HasStringFunc = requires(T const& a)
+{
+    { to_string(a) } -> std::convertible_to<std::string>;
+};
+
+// Opt-in hook: writes itself into the output iterator and returns the
+// iterator past the written characters, without building a string
+template <typename T, typename Out>
+concept Writable = requires(T const& a, Out out)
+{
+    { a.write_to(out) } -> std::same_as<Out>;
+};
+
+// strings, string views and string literals: printed verbatim, not as a
+// range of chars (a literal without its terminating null)
+template <typename T>
+concept StringLike = std::convertible_to<T const&, std::string_view>;
+
+// Anything with begin() and end() that can be read element by element
+template <typename R>
+concept Range = requires(R const& r)
+{
+    { std::begin(r) } -> std::input_iterator;
+    std::end(r);
+};
+
+// numbers, bool ("true"/"false") and char (the character itself)
+template <typename T>
+concept Arithmetic = std::is_arithmetic_v<T>;
+
+template <typename R>
+using RangeValue = std::iter_value_t<decltype(std::begin(std::declval<R const&>()))>;
+
+// Out is the iterator written to: write_to() hooks may accept only some
+template <typename T, typename Out>
+concept PrintableElement = Writable<T, Out> || StringLike<T> || Arithmetic<T>
+                           || Stringable<T> || HasStringFunc<T>;
+
+template <typename T, typename Out = std::back_insert_iterator<std::string>>
+concept Printable = PrintableElement<T, Out>
+                    || (Range<T> && PrintableElement<RangeValue<T>, Out>);
+
+// writes a into out, most direct way first; only the legacy to_string()
+// paths build an intermediate string
+template <std::output_iterator<char> Out, typename T>
+    requires Printable<T, Out>
+Out write_pretty(Out out, T const& a)
+{
+    if constexpr (Writable<T, Out>)
+    {
+        return a.write_to(out);
+    }
+    else if constexpr (StringLike<T>)
+    {
+        std::string_view text = a;
+        return std::copy(text.begin(), text.end(), out);
+    }
+    else if constexpr (std::same_as<T, bool>)
+    {
+        char const* text = a ? "true" : "false";
+        return std::copy(text, text + (a ? 4 : 5), out);
+    }
+    else if constexpr (std::same_as<T, char>)
+    {
+        *out++ = a;
+        return out;
+    }
+    else if constexpr (Arithmetic<T>)
+    {
+        char digits[64];
+        auto result = std::to_chars(digits, digits + sizeof(digits), a);
+        return std::copy(digits, result.ptr, out);
+    }
+    else if constexpr (Stringable<T>)
+    {
+        std::string s = a.to_string();
+        return std::copy(s.begin(), s.end(), out);
+    }
+    else if constexpr (HasStringFunc<T>)
+    {
+        std::string s = to_string(a);
+        return std::copy(s.begin(), s.end(), out);
+    }
+    else
+    {
+        for (RangeValue<T> const& element : a)  // also unwraps vector<bool> bits
+        {
+            *out++ = ' ';
+            out = write_pretty(out, element);
+            *out++ = ' ';
+        }
+        return out;
+    }
+}
+
+// formats into a buffer that is reused from call to call, so printing
+// allocates nothing once the buffer has grown to the largest output;
+// Printable's default Out is the iterator used here
+void pretty_print(Printable auto const& a)
+{
+    static thread_local std::string buffer;
+    buffer.clear();
+    write_pretty(std::back_inserter(buffer), a);
+    buffer += '\n';
+    std::cout << buffer;
+}
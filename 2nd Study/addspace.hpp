@@ -1,3 +1,8 @@
+#include <iostream>
+
+// print() as a fold expression, each argument followed by a space
+namespace fold {
+
 template<typename T>
 class AddSpace
 {
@@ -16,3 +21,4 @@ void print (Args... args) {
   ( std::cout << ... << AddSpace(args) ) << '\n';
 }
 
+} // namespace fold
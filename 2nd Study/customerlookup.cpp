@@ -0,0 +1,91 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "varusing.hpp"
+
+// count heap allocations of the whole program
+static std::atomic<long> allocations{0};
+
+void* operator new (std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete (void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete (void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+// the former functors: getName() returned a copy of the name
+struct CopyingEq {
+  bool operator() (Customer const& c1, Customer const& c2) const {
+    return std::string(c1.getName()) == std::string(c2.getName());
+  }
+};
+
+struct CopyingHash {
+  std::size_t operator() (Customer const& c) const {
+    return std::hash<std::string>()(std::string(c.getName()));
+  }
+};
+
+template<typename Find>
+void measure (char const* name, std::vector<std::string> const& keys, Find find)
+{
+  long before = allocations.load();
+  std::size_t found = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto const& key : keys) {
+    found += find(key);
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  std::cout << name << ": " << keys.size() / d.count() / 1e6 << " M lookups/s, "
+            << double(allocations.load() - before) / keys.size()
+            << " allocations per lookup (" << found << " found)\n";
+}
+
+int main()
+{
+  // names longer than the small string buffer, so copies allocate
+  std::size_t numCustomers = 1'000'000;
+  auto nameOf = [](std::size_t i) {
+    return "customer-" + std::to_string(i * 7919 % 10'000'019) + "-of-the-shop";
+  };
+  std::unordered_set<Customer,CopyingHash,CopyingEq> copying;
+  std::unordered_set<Customer,CustomerOP,CustomerOP> transparent;
+  for (std::size_t i = 0; i < numCustomers; ++i) {
+    copying.emplace(nameOf(i));
+    transparent.emplace(nameOf(i));
+  }
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < numCustomers; ++i) {
+    keys.push_back(nameOf(i * 3 % (2 * numCustomers)));  // some keys miss
+  }
+
+  measure("copying, find(Customer)   ", keys, [&](std::string const& key) {
+    return copying.find(Customer{key}) != copying.end();
+  });
+  measure("transparent, find(Customer)", keys, [&](std::string const& key) {
+    return transparent.find(Customer{key}) != transparent.end();
+  });
+  measure("transparent, find(name)   ", keys, [&](std::string const& key) {
+    return transparent.find(std::string_view(key)) != transparent.end();
+  });
+  measure("transparent, find(string) ", keys, [&](std::string const& key) {
+    return transparent.find(key) != transparent.end();   // as a string_view
+  });
+}
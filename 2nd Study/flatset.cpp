@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "varusing.hpp"
+#include "flatset.hpp"
+
+// short names, so that they fit into the small string buffer
+std::string nameOf (std::size_t i)
+{
+  return "c" + std::to_string(i);
+}
+
+template<typename F>
+double seconds (F f)
+{
+  auto start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  return d.count();
+}
+
+// insert n customers, look up all of them and n missing names (by name,
+// without creating a Customer), then erase all of them
+template<typename Set>
+void measure (char const* name, std::size_t n)
+{
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+  std::vector<std::string> hits, misses;
+  hits.reserve(n);
+  misses.reserve(n);
+  for (std::size_t i : order) {
+    hits.push_back(nameOf(i));
+    misses.push_back(nameOf(i + n));
+  }
+
+  Set coll;
+  std::size_t found = 0, missing = 0, erased = 0;
+  double insert = seconds([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      coll.insert(Customer(nameOf(i)));
+    }
+  });
+  double lookup = seconds([&] {
+    for (auto const& key : hits) {
+      found += coll.find(std::string_view(key)) != coll.end();
+    }
+  });
+  double miss = seconds([&] {
+    for (auto const& key : misses) {
+      missing += coll.find(std::string_view(key)) == coll.end();
+    }
+  });
+  double erase = seconds([&] {
+    for (auto const& key : hits) {
+      erased += coll.erase(Customer(key));
+    }
+  });
+  auto mops = [n](double s) { return n / s / 1e6; };
+  std::cout << "  " << name << ": insert " << mops(insert)
+            << ", hit " << mops(lookup) << ", miss " << mops(miss)
+            << ", erase " << mops(erase) << " Mops/s";
+  if (found != n || missing != n || erased != n || !coll.empty()) {
+    std::cout << " MISMATCH";
+  }
+  std::cout << '\n';
+}
+
+int main(int argc, char* argv[])
+{
+  FlatHashSet<Customer,CustomerOP> customers;   // one functor hashes and compares
+  customers.insert(Customer("alice"));
+  customers.insert(Customer("bob"));
+  std::cout << "contains alice: " << customers.contains(std::string_view("alice"))
+            << ", size " << customers.size() << '\n';
+
+  FlatHashMap<std::string,int,Overloader<std::hash<std::string>,
+                                         std::equal_to<std::string>>> visits;
+  ++visits["alice"];
+  ++visits["alice"];
+  std::cout << "alice visited " << visits["alice"] << " times\n";
+
+  // sizes in millions of customers (100 needs several GB of memory)
+  std::vector<std::size_t> sizes;
+  for (int i = 1; i < argc; ++i) {
+    sizes.push_back(std::strtoul(argv[i], nullptr, 10) * 1'000'000);
+  }
+  if (sizes.empty()) {
+    sizes = {1'000'000, 10'000'000};
+  }
+  for (std::size_t n : sizes) {
+    std::cout << n << " customers:\n";
+    measure<FlatHashSet<Customer,CustomerOP>>("FlatHashSet       ", n);
+    measure<std::unordered_set<Customer,CustomerOP,CustomerOP>>("std::unordered_set", n);
+  }
+}
@@ -0,0 +1,441 @@
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// open-addressing hash table storing its slots in one flat array
+// - HashEq is a single functor for hashing and equality (e.g. an Overloader
+//   of a hasher and an equality): hashEq(key) and hashEq(key1, key2)
+// - next to every slot a control byte holds 7 bits of the hash (or marks the
+//   slot empty/deleted), so a probe compares 16 control bytes at once and
+//   only calls the equality for slots whose hash fragment matches
+// - KeyOf extracts the key from a slot (the slot itself for sets)
+template<typename Slot, typename KeyOf, typename HashEq>
+class FlatHashTable {
+  private:
+    using ctrl_t = std::int8_t;
+    static constexpr ctrl_t emptySlot = -128;    // 0b10000000
+    static constexpr ctrl_t deletedSlot = -2;    // 0b11111110
+    static constexpr std::size_t groupSize = 16;
+
+    // the 16 control bytes of a group
+    struct Group {
+#if defined(__SSE2__)
+      __m128i ctrl;
+      explicit Group(ctrl_t const* p)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))) {
+      }
+      unsigned match(ctrl_t h2) const {   // bit i: slot i has fragment h2
+        return static_cast<unsigned>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+      }
+      unsigned matchEmpty() const {
+        return match(emptySlot);
+      }
+      unsigned matchFree() const {        // empty or deleted: sign bit set
+        return static_cast<unsigned>(_mm_movemask_epi8(ctrl));
+      }
+#else
+      ctrl_t ctrl[groupSize];
+      explicit Group(ctrl_t const* p) {
+        std::memcpy(ctrl, p, groupSize);
+      }
+      unsigned match(ctrl_t h2) const {
+        unsigned bits = 0;
+        for (std::size_t i = 0; i < groupSize; ++i) {
+          bits |= unsigned(ctrl[i] == h2) << i;
+        }
+        return bits;
+      }
+      unsigned matchEmpty() const {
+        return match(emptySlot);
+      }
+      unsigned matchFree() const {
+        unsigned bits = 0;
+        for (std::size_t i = 0; i < groupSize; ++i) {
+          bits |= unsigned(ctrl[i] < 0) << i;
+        }
+        return bits;
+      }
+#endif
+    };
+
+    std::unique_ptr<ctrl_t[]> ctrl;   // one control byte per slot
+    Slot* slots = nullptr;            // raw storage; full slots constructed
+    std::size_t capacity = 0;         // number of slots (multiple of 16)
+    std::size_t numElems = 0;
+    std::size_t numDeleted = 0;
+    [[no_unique_address]] HashEq hashEq;
+
+  public:
+    // Const: const_iterator, whose elements are read-only
+    template<bool Const>
+    class basic_iterator {
+      private:
+        friend class FlatHashTable;
+        template<bool> friend class basic_iterator;
+        using Table = std::conditional_t<Const, FlatHashTable const, FlatHashTable>;
+        Table* table;
+        std::size_t index;
+        basic_iterator(Table* t, std::size_t i) : table(t), index(i) {
+          skipFree();
+        }
+        void skipFree() {
+          while (index < table->capacity && table->ctrl[index] < 0) {
+            ++index;
+          }
+        }
+      public:
+        using value_type = Slot;
+        using reference = std::conditional_t<Const, Slot const&, Slot&>;
+        using pointer = std::conditional_t<Const, Slot const*, Slot*>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+        basic_iterator() : table(nullptr), index(0) {
+        }
+        // iterator -> const_iterator
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(basic_iterator<false> const& other)
+          : table(other.table), index(other.index) {
+        }
+        reference operator* () const {
+          return table->slots[index];
+        }
+        pointer operator-> () const {
+          return table->slots + index;
+        }
+        basic_iterator& operator++ () {
+          ++index;
+          skipFree();
+          return *this;
+        }
+        bool operator== (basic_iterator const& other) const {
+          return index == other.index;
+        }
+        bool operator!= (basic_iterator const& other) const {
+          return index != other.index;
+        }
+    };
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    FlatHashTable() = default;
+    explicit FlatHashTable(HashEq const& he) : hashEq(he) {
+    }
+    FlatHashTable(FlatHashTable const& other);
+    FlatHashTable(FlatHashTable&& other) noexcept;
+    FlatHashTable& operator= (FlatHashTable other) noexcept {
+      swap(other);
+      return *this;
+    }
+    ~FlatHashTable();
+
+    iterator begin() {
+      return iterator(this, 0);
+    }
+    iterator end() {
+      return iterator(this, capacity);
+    }
+    const_iterator begin() const {
+      return const_iterator(this, 0);
+    }
+    const_iterator end() const {
+      return const_iterator(this, capacity);
+    }
+    std::size_t size() const {
+      return numElems;
+    }
+    bool empty() const {
+      return numElems == 0;
+    }
+
+    template<typename K>
+    iterator find(K const& key) {               // any key HashEq accepts
+      return iterator(this, indexOf(key));
+    }
+    template<typename K>
+    const_iterator find(K const& key) const {
+      return const_iterator(this, indexOf(key));
+    }
+    template<typename K>
+    bool contains(K const& key) const {
+      return find(key) != end();
+    }
+    template<typename K, typename... Args>
+    std::pair<iterator,bool> try_emplace(K const& key, Args&&... args);
+    template<typename K>
+    std::size_t erase(K const& key);
+    void reserve(std::size_t n);                // room for n elements
+
+    void swap(FlatHashTable& other) noexcept {
+      using std::swap;
+      swap(ctrl, other.ctrl);
+      swap(slots, other.slots);
+      swap(capacity, other.capacity);
+      swap(numElems, other.numElems);
+      swap(numDeleted, other.numDeleted);
+      swap(hashEq, other.hashEq);
+    }
+
+  private:
+    std::size_t hashOf(auto const& key) const {
+      // mix, so that weak hashes (e.g. identity for integers) spread as well
+      std::uint64_t h = static_cast<std::uint64_t>(hashEq(key));
+      h *= 0x9E3779B97F4A7C15ull;
+      return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+    static ctrl_t fragment(std::size_t hash) {  // 7 bits kept in ctrl
+      return static_cast<ctrl_t>(hash & 0x7F);
+    }
+    std::size_t firstGroup(std::size_t hash) const {
+      return (hash >> 7) & (capacity / groupSize - 1);
+    }
+    template<typename K>
+    std::size_t indexOf(K const& key) const;
+    template<typename K>
+    std::size_t findIndex(K const& key, std::size_t hash) const;
+    std::size_t findFree(std::size_t hash) const;
+    void rehash(std::size_t newCapacity);
+    void destroyAll();
+};
+
+template<typename Slot, typename KeyOf, typename HashEq>
+FlatHashTable<Slot,KeyOf,HashEq>::FlatHashTable (FlatHashTable const& other)
+  : FlatHashTable(other.hashEq)   // delegating: if a copy throws, the
+{                                 // destructor frees what was built so far
+  reserve(other.numElems);
+  for (auto const& slot : other) {
+    std::size_t hash = hashOf(KeyOf()(slot));
+    std::size_t i = findFree(hash);
+    ::new (static_cast<void*>(slots + i)) Slot(slot);
+    ctrl[i] = fragment(hash);
+    ++numElems;
+  }
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+FlatHashTable<Slot,KeyOf,HashEq>::FlatHashTable (FlatHashTable&& other) noexcept
+  : ctrl(std::move(other.ctrl)), slots(std::exchange(other.slots, nullptr)),
+    capacity(std::exchange(other.capacity, 0)),
+    numElems(std::exchange(other.numElems, 0)),
+    numDeleted(std::exchange(other.numDeleted, 0)), hashEq(other.hashEq)
+{
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+FlatHashTable<Slot,KeyOf,HashEq>::~FlatHashTable ()
+{
+  destroyAll();
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+template<typename K>
+std::size_t FlatHashTable<Slot,KeyOf,HashEq>::indexOf (K const& key) const
+{
+  if (capacity == 0) {
+    return capacity;
+  }
+  return findIndex(key, hashOf(key));
+}
+
+// probe group after group (triangular steps visit every group once);
+// returns capacity if key is not found
+template<typename Slot, typename KeyOf, typename HashEq>
+template<typename K>
+std::size_t FlatHashTable<Slot,KeyOf,HashEq>::findIndex (K const& key,
+                                                         std::size_t hash) const
+{
+  std::size_t mask = capacity / groupSize - 1;
+  for (std::size_t g = firstGroup(hash), step = 1; ; g = (g + step++) & mask) {
+    Group group(ctrl.get() + g * groupSize);
+    for (unsigned bits = group.match(fragment(hash)); bits != 0; bits &= bits - 1) {
+      std::size_t i = g * groupSize + static_cast<std::size_t>(std::countr_zero(bits));
+      if (hashEq(KeyOf()(slots[i]), key)) {
+        return i;
+      }
+    }
+    if (group.matchEmpty() != 0) {
+      return capacity;            // key would have been placed here
+    }
+  }
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+std::size_t FlatHashTable<Slot,KeyOf,HashEq>::findFree (std::size_t hash) const
+{
+  std::size_t mask = capacity / groupSize - 1;
+  for (std::size_t g = firstGroup(hash), step = 1; ; g = (g + step++) & mask) {
+    if (unsigned bits = Group(ctrl.get() + g * groupSize).matchFree()) {
+      return g * groupSize + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+}
+
+// key must be the key of the new slot, which is constructed from args
+template<typename Slot, typename KeyOf, typename HashEq>
+template<typename K, typename... Args>
+auto FlatHashTable<Slot,KeyOf,HashEq>::try_emplace (K const& key, Args&&... args)
+  -> std::pair<iterator,bool>
+{
+  std::size_t hash = hashOf(key);
+  if (capacity != 0) {
+    if (std::size_t i = findIndex(key, hash); i != capacity) {
+      return {iterator(this, i), false};
+    }
+  }
+  if ((numElems + numDeleted + 1) * 8 > capacity * 7) {   // max load 7/8
+    // grow if mostly full of elements, else only drop the tombstones
+    rehash(numElems + 1 > capacity * 7 / 16 ? capacity * 2 : capacity);
+  }
+  std::size_t i = findFree(hash);
+  ::new (static_cast<void*>(slots + i)) Slot(std::forward<Args>(args)...);
+  numDeleted -= ctrl[i] == deletedSlot;
+  ctrl[i] = fragment(hash);
+  ++numElems;
+  return {iterator(this, i), true};
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+template<typename K>
+std::size_t FlatHashTable<Slot,KeyOf,HashEq>::erase (K const& key)
+{
+  std::size_t i = indexOf(key);
+  if (i == capacity) {
+    return 0;
+  }
+  std::destroy_at(slots + i);
+  // a group with an empty slot ends every probe, so no probe has passed it
+  // and the slot can become empty again instead of a tombstone
+  Group group(ctrl.get() + i / groupSize * groupSize);
+  if (group.matchEmpty() != 0) {
+    ctrl[i] = emptySlot;
+  }
+  else {
+    ctrl[i] = deletedSlot;
+    ++numDeleted;
+  }
+  --numElems;
+  return 1;
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+void FlatHashTable<Slot,KeyOf,HashEq>::reserve (std::size_t n)
+{
+  std::size_t needed = groupSize;
+  while (needed * 7 / 8 < n) {
+    needed *= 2;
+  }
+  if (needed > capacity) {
+    rehash(needed);
+  }
+}
+
+// builds the new table aside and only swaps it in when complete: if an
+// allocation, the hash or a copy throws, the table is left unchanged
+// (elements are moved only if their move constructor cannot throw)
+template<typename Slot, typename KeyOf, typename HashEq>
+void FlatHashTable<Slot,KeyOf,HashEq>::rehash (std::size_t newCapacity)
+{
+  newCapacity = newCapacity < groupSize ? groupSize : newCapacity;
+  FlatHashTable table(hashEq);      // its destructor cleans up on exceptions
+  table.ctrl = std::make_unique<ctrl_t[]>(newCapacity);
+  std::memset(table.ctrl.get(), emptySlot, newCapacity);
+  table.slots = std::allocator<Slot>().allocate(newCapacity);
+  table.capacity = newCapacity;
+  for (std::size_t i = 0; i < capacity; ++i) {
+    if (ctrl[i] >= 0) {
+      std::size_t hash = hashOf(KeyOf()(slots[i]));
+      std::size_t j = table.findFree(hash);
+      ::new (static_cast<void*>(table.slots + j)) Slot(std::move_if_noexcept(slots[i]));
+      table.ctrl[j] = fragment(hash);
+      ++table.numElems;
+    }
+  }
+  swap(table);                      // table now destroys the old elements
+}
+
+template<typename Slot, typename KeyOf, typename HashEq>
+void FlatHashTable<Slot,KeyOf,HashEq>::destroyAll ()
+{
+  if (slots == nullptr) {
+    return;
+  }
+  for (std::size_t i = 0; i < capacity; ++i) {
+    if (ctrl[i] >= 0) {
+      std::destroy_at(slots + i);
+    }
+  }
+  std::allocator<Slot>().deallocate(slots, capacity);
+  slots = nullptr;
+}
+
+struct FlatSetKeyOf {
+  template<typename T>
+  T const& operator() (T const& key) const {
+    return key;
+  }
+};
+
+struct FlatMapKeyOf {
+  template<typename K, typename T>
+  K const& operator() (std::pair<K,T> const& slot) const {
+    return slot.first;
+  }
+};
+
+// set of Key in a flat table; like std::unordered_set, its iterators are
+// const iterators, so keys can't be modified in place
+template<typename Key, typename HashEq>
+class FlatHashSet : public FlatHashTable<Key,FlatSetKeyOf,HashEq> {
+  private:
+    using Base = FlatHashTable<Key,FlatSetKeyOf,HashEq>;
+  public:
+    using Base::Base;
+    using iterator = typename Base::const_iterator;
+    using const_iterator = typename Base::const_iterator;
+    iterator begin() const {
+      return Base::begin();
+    }
+    iterator end() const {
+      return Base::end();
+    }
+    template<typename K>
+    iterator find(K const& key) const {
+      return Base::find(key);
+    }
+    template<typename K, typename... Args>
+    std::pair<iterator,bool> try_emplace(K const& key, Args&&... args) {
+      auto [pos, inserted] = Base::try_emplace(key, std::forward<Args>(args)...);
+      return {pos, inserted};
+    }
+    std::pair<iterator,bool> insert(Key const& key) {
+      return try_emplace(key, key);
+    }
+    std::pair<iterator,bool> insert(Key&& key) {
+      return try_emplace(key, std::move(key));
+    }
+};
+
+// map from Key to T in a flat table; slots are std::pair<Key,T>, whose
+// first member must not be modified through iterators
+template<typename Key, typename T, typename HashEq>
+class FlatHashMap : public FlatHashTable<std::pair<Key,T>,FlatMapKeyOf,HashEq> {
+  public:
+    using FlatHashTable<std::pair<Key,T>,FlatMapKeyOf,HashEq>::FlatHashTable;
+    auto insert(std::pair<Key,T> const& value) {
+      return this->try_emplace(value.first, value);
+    }
+    T& operator[] (Key const& key) {
+      return this->try_emplace(key, std::piecewise_construct,
+                               std::forward_as_tuple(key),
+                               std::forward_as_tuple()).first->second;
+    }
+};
@@ -1,20 +1,4 @@
-// define binary tree structure and traverse helpers:
-struct Node {
-  int value;
-  Node* left;
-  Node* right;
-  Node (int i=0) : value(i), left(nullptr), right(nullptr) {
-  }
-  // ...
-};
-auto left = &Node::left;
-auto right = &Node::right;
-
-// traverse tree, using fold expression:
-template<typename T, typename... TP>
-Node* traverse (T np, TP... paths) {
-  return (np ->* ... ->* paths);      // np ->* paths1 ->* paths2 ...
-}
+#include "foldtraverse.hpp"
 
 int main()
 {
@@ -27,5 +11,9 @@ int main()
   // traverse binary tree:
   Node* node = traverse(root, left, right);
   // ...
-}
 
+  // a missing child yields nullptr instead of crashing:
+  Node* missing = traverse_safe(root, right, left);
+  (void)node;
+  (void)missing;
+}
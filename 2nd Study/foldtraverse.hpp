@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TRAVERSE_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define TRAVERSE_PREFETCH(p) ((void)(p))
+#endif
+
+// define binary tree structure and traverse helpers:
+struct Node {
+  int value;
+  Node* left;
+  Node* right;
+  Node (int i=0) : value(i), left(nullptr), right(nullptr) {
+  }
+  // ...
+};
+inline constexpr auto left = &Node::left;
+inline constexpr auto right = &Node::right;
+
+// traverse tree, using fold expression:
+template<typename T, typename... TP>
+Node* traverse (T np, TP... paths) {
+  return (np ->* ... ->* paths);      // np ->* paths1 ->* paths2 ...
+}
+
+// traverse tree, stopping with nullptr at a missing child:
+template<typename T, typename... TP>
+T* traverse_safe (T* np, TP... paths) {
+  ((np = np != nullptr ? np ->* paths : nullptr), ...);
+  return np;
+}
+
+// traverse from all roots[i] into out[i] (null-safe): the traversals of a
+// group advance in lockstep, so the next nodes of all of them are prefetched
+// and their cache misses overlap instead of forming one serial chain;
+// roots and out are contiguous ranges of T* (vector, array, span, ...)
+template<std::size_t GroupSize = 16, std::ranges::contiguous_range Roots,
+         std::ranges::contiguous_range Out, typename... TP>
+  requires (std::is_member_object_pointer_v<TP> && ...)
+void traverse_many (Roots const& roots, Out&& out, TP... paths) {
+  using T = std::remove_pointer_t<std::ranges::range_value_t<Roots>>;
+  std::span<T* const> in(roots);
+  std::span<T*> dst(out);
+  std::size_t n = in.size() < dst.size() ? in.size() : dst.size();
+  for (std::size_t first = 0; first < n; first += GroupSize) {
+    std::size_t count = n - first < GroupSize ? n - first : GroupSize;
+    T* cur[GroupSize];
+    for (std::size_t j = 0; j < count; ++j) {
+      cur[j] = in[first + j];
+      TRAVERSE_PREFETCH(cur[j]);
+    }
+    auto step = [&](auto path) {
+      for (std::size_t j = 0; j < count; ++j) {
+        if (cur[j] != nullptr) {
+          cur[j] = cur[j] ->* path;
+          TRAVERSE_PREFETCH(cur[j]);
+        }
+      }
+    };
+    (step(paths), ...);
+    for (std::size_t j = 0; j < count; ++j) {
+      dst[first + j] = cur[j];
+    }
+  }
+}
+
+template<std::size_t GroupSize = 16, std::ranges::contiguous_range Roots,
+         typename... TP>
+  requires (std::is_member_object_pointer_v<TP> && ...)
+auto traverse_many (Roots const& roots, TP... paths) {
+  using T = std::remove_pointer_t<std::ranges::range_value_t<Roots>>;
+  std::vector<T*> out(std::ranges::size(roots));
+  traverse_many<GroupSize>(roots, out, paths...);
+  return out;
+}
+
+// paths known only at run time: follow the member pointers of path from np
+// (null-safe)
+template<typename T, typename M>
+T* traverse_path (T* np, std::span<M const> path) {
+  for (M step : path) {
+    if (np == nullptr) {
+      break;
+    }
+    np = np ->* step;
+  }
+  return np;
+}
+
+// traverse_many() with a run-time path per root: roots[i] follows
+// paths[i*depth] ... paths[i*depth + depth-1], in lockstep with its group
+template<std::size_t GroupSize = 16, typename T, typename M>
+void traverse_paths (std::span<T* const> roots, std::span<M const> paths,
+                     std::size_t depth, std::span<T*> out) {
+  std::size_t n = roots.size() < out.size() ? roots.size() : out.size();
+  if (depth > 0 && paths.size() / depth < n) {
+    n = paths.size() / depth;
+  }
+  for (std::size_t first = 0; first < n; first += GroupSize) {
+    std::size_t count = n - first < GroupSize ? n - first : GroupSize;
+    T* cur[GroupSize];
+    for (std::size_t j = 0; j < count; ++j) {
+      cur[j] = roots[first + j];
+      TRAVERSE_PREFETCH(cur[j]);
+    }
+    for (std::size_t d = 0; d < depth; ++d) {
+      for (std::size_t j = 0; j < count; ++j) {
+        if (cur[j] != nullptr) {
+          cur[j] = cur[j] ->* paths[(first + j) * depth + d];
+          TRAVERSE_PREFETCH(cur[j]);
+        }
+      }
+    }
+    for (std::size_t j = 0; j < count; ++j) {
+      out[first + j] = cur[j];
+    }
+  }
+}
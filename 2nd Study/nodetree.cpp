@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "nodetree.hpp"
+
+// random root-to-leaf descents; paths are chosen at run time from the
+// member pointers left/right (cleft/cright for CompactTree)
+template<typename Descend>
+void measure (char const* name, std::size_t bytesPerNode, int depth,
+              Descend descend)
+{
+  std::mt19937 rng(7);
+  std::size_t lookups = 2'000'000;
+  long sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < lookups; ++i) {
+    sum += descend(static_cast<std::uint32_t>(rng()), depth);
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  std::cout << name << ": " << bytesPerNode << " bytes/node, "
+            << d.count() * 1e9 / lookups << " ns per descent (checksum "
+            << sum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+  std::size_t numNodes = argc > 1 ? std::stoul(argv[1]) : 10'000'000;
+  int depth = 0;                  // levels below the root that are complete
+  while ((std::size_t(2) << (depth + 1)) - 1 <= numNodes) {
+    ++depth;
+  }
+  // complete binary tree: node k has children 2k+1 and 2k+2; the nodes are
+  // created in random order, as if built by unrelated insertions
+  std::vector<std::uint32_t> creation(numNodes);
+  std::iota(creation.begin(), creation.end(), 0);
+  std::shuffle(creation.begin(), creation.end(), std::mt19937(42));
+
+  auto descendNodes = [](Node* root) {
+    return [root](std::uint32_t bits, int depth) {
+      Node* n = root;
+      for (int d = 0; d < depth; ++d, bits >>= 1) {
+        n = n ->* (bits & 1 ? left : right);
+      }
+      return n->value;
+    };
+  };
+
+  {
+    // individual new Node{...} as in foldtraverse.cpp (never freed there)
+    std::vector<std::unique_ptr<Node>> owned(numNodes);
+    for (auto k : creation) {
+      owned[k] = std::make_unique<Node>(static_cast<int>(k));
+    }
+    for (std::size_t k = 0; 2*k+2 < numNodes; ++k) {
+      owned[k]->left = owned[2*k+1].get();
+      owned[k]->right = owned[2*k+2].get();
+    }
+    measure("new Node        ", sizeof(Node) + sizeof(void*), depth,
+            descendNodes(owned[0].get()));
+  }
+  {
+    NodeTree tree(numNodes);
+    std::vector<Node*> byKey(numNodes);
+    for (auto k : creation) {
+      byKey[k] = tree.create(static_cast<int>(k));
+    }
+    for (std::size_t k = 0; 2*k+2 < numNodes; ++k) {
+      byKey[k]->left = byKey[2*k+1];
+      byKey[k]->right = byKey[2*k+2];
+    }
+    tree.setRoot(byKey[0]);
+    measure("NodeTree        ", sizeof(Node), depth, descendNodes(tree.root()));
+    tree.relayout(Layout::bfs);
+    measure("NodeTree bfs    ", sizeof(Node), depth, descendNodes(tree.root()));
+    tree.relayout(Layout::veb);
+    measure("NodeTree veb    ", sizeof(Node), depth, descendNodes(tree.root()));
+    Node* n = traverse(tree.root(), left, right);   // paths work unchanged
+    (void)n;
+  }
+  {
+    CompactTree tree(numNodes);
+    std::vector<std::uint32_t> byKey(numNodes);
+    for (auto k : creation) {
+      byKey[k] = tree.create(static_cast<int>(k));
+    }
+    for (std::size_t k = 0; 2*k+2 < numNodes; ++k) {
+      tree[byKey[k]].left = byKey[2*k+1];
+      tree[byKey[k]].right = byKey[2*k+2];
+    }
+    tree.setRoot(byKey[0]);
+    auto descend = [&](std::uint32_t bits, int depth) {
+      std::uint32_t i = tree.root();
+      for (int d = 0; d < depth; ++d, bits >>= 1) {
+        i = tree.traverse(i, bits & 1 ? cleft : cright);
+      }
+      return tree[i].value;
+    };
+    measure("CompactTree     ", sizeof(CompactNode), depth, descend);
+    tree.relayout(Layout::bfs);
+    measure("CompactTree bfs ", sizeof(CompactNode), depth, descend);
+    tree.relayout(Layout::veb);
+    measure("CompactTree veb ", sizeof(CompactNode), depth, descend);
+  }
+}
@@ -0,0 +1,223 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "foldtraverse.hpp"
+
+// node of CompactTree: children are 32-bit indices into the tree's arena
+struct CompactNode {
+  static constexpr std::uint32_t none = 0xFFFFFFFFu;
+  int value;
+  std::uint32_t left;
+  std::uint32_t right;
+  CompactNode (int i=0) : value(i), left(none), right(none) {
+  }
+};
+inline constexpr auto cleft = &CompactNode::left;
+inline constexpr auto cright = &CompactNode::right;
+
+enum class Layout {
+  bfs,                            // level by level
+  veb                             // van Emde Boas: recursive subtree blocks
+};
+
+// order in which the nodes reachable from root are placed by layout;
+// children(i) returns the pair of child indices of node i (none if missing)
+template<typename Children>
+std::vector<std::uint32_t> layoutOrder (std::uint32_t root, Layout layout,
+                                        Children children)
+{
+  constexpr std::uint32_t none = CompactNode::none;
+  std::vector<std::uint32_t> order;
+  if (root == none) {
+    return order;
+  }
+  if (layout == Layout::bfs) {
+    order.push_back(root);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      auto [l, r] = children(order[i]);
+      if (l != none) order.push_back(l);
+      if (r != none) order.push_back(r);
+    }
+    return order;
+  }
+
+  // van Emde Boas: lay out the top half of the levels as one block, then
+  // each subtree hanging below it as a block of its own, recursively
+  std::size_t height = 0;
+  for (std::vector<std::uint32_t> level{root}, next; !level.empty();
+       level.swap(next), next.clear()) {
+    ++height;
+    for (auto i : level) {
+      auto [l, r] = children(i);
+      if (l != none) next.push_back(l);
+      if (r != none) next.push_back(r);
+    }
+  }
+  auto veb = [&](auto& self, std::uint32_t top, std::size_t levels) -> void {
+    if (levels == 1) {
+      order.push_back(top);
+      return;
+    }
+    std::size_t topLevels = levels / 2;
+    self(self, top, topLevels);
+    std::vector<std::uint32_t> frontier{top}, next;   // bottom subtree roots
+    for (std::size_t d = 0; d < topLevels; ++d, frontier.swap(next)) {
+      next.clear();
+      for (auto i : frontier) {
+        auto [l, r] = children(i);
+        if (l != none) next.push_back(l);
+        if (r != none) next.push_back(r);
+      }
+    }
+    for (auto i : frontier) {
+      self(self, i, levels - topLevels);
+    }
+  };
+  veb(veb, root, height);
+  return order;
+}
+
+// binary tree of Node allocated from one contiguous arena that is freed as
+// a whole; the nodes are ordinary Nodes, so traverse() works unchanged
+class NodeTree {
+  private:
+    std::vector<Node> nodes;      // arena; never reallocated
+    Node* rootNode = nullptr;
+  public:
+    explicit NodeTree(std::size_t capacity) {
+      nodes.reserve(capacity);
+    }
+    NodeTree(NodeTree&&) = default;
+    NodeTree& operator= (NodeTree&&) = default;
+
+    Node* create(int value) {     // allocate node from the arena
+      // growing would move every node and leave all links dangling
+      if (nodes.size() == nodes.capacity()) {
+        throw std::length_error("NodeTree: arena capacity exceeded");
+      }
+      return &nodes.emplace_back(value);
+    }
+    Node* root() const {
+      return rootNode;
+    }
+    void setRoot(Node* n) {
+      rootNode = n;
+    }
+    std::size_t size() const {
+      return nodes.size();
+    }
+    std::size_t bytes() const {
+      return nodes.capacity() * sizeof(Node);
+    }
+    // reorder nodes (drops unreachable ones); all Node*s obtained from
+    // create() or root() before are invalidated
+    void relayout(Layout layout);
+};
+
+inline void NodeTree::relayout (Layout layout)
+{
+  constexpr std::uint32_t none = CompactNode::none;
+  auto index = [&](Node const* n) {
+    return n != nullptr ? static_cast<std::uint32_t>(n - nodes.data()) : none;
+  };
+  auto order = layoutOrder(index(rootNode), layout, [&](std::uint32_t i) {
+    return std::pair(index(nodes[i].left), index(nodes[i].right));
+  });
+  std::vector<std::uint32_t> position(nodes.size(), none);
+  for (std::size_t p = 0; p < order.size(); ++p) {
+    position[order[p]] = static_cast<std::uint32_t>(p);
+  }
+  std::vector<Node> relaid;
+  relaid.reserve(nodes.capacity());
+  for (auto i : order) {
+    relaid.emplace_back(nodes[i].value);
+  }
+  auto moved = [&](Node const* n) {
+    return n != nullptr ? &relaid[position[index(n)]] : nullptr;
+  };
+  for (std::size_t p = 0; p < order.size(); ++p) {
+    relaid[p].left = moved(nodes[order[p]].left);
+    relaid[p].right = moved(nodes[order[p]].right);
+  }
+  rootNode = relaid.empty() ? nullptr : &relaid[0];
+  nodes.swap(relaid);
+}
+
+// binary tree of CompactNode: half the size of Node per node, and the
+// arena may grow because links are indices instead of pointers
+class CompactTree {
+  private:
+    std::vector<CompactNode> nodes;
+    std::uint32_t rootIndex = CompactNode::none;
+  public:
+    CompactTree() = default;
+    explicit CompactTree(std::size_t capacity) {
+      nodes.reserve(capacity);
+    }
+
+    std::uint32_t create(int value) {
+      if (nodes.size() >= CompactNode::none) {
+        throw std::length_error("CompactTree: too many nodes for 32-bit indices");
+      }
+      nodes.emplace_back(value);
+      return static_cast<std::uint32_t>(nodes.size() - 1);
+    }
+    CompactNode& operator[] (std::uint32_t i) {
+      return nodes[i];
+    }
+    CompactNode const& operator[] (std::uint32_t i) const {
+      return nodes[i];
+    }
+    std::uint32_t root() const {
+      return rootIndex;
+    }
+    void setRoot(std::uint32_t i) {
+      rootIndex = i;
+    }
+    std::size_t size() const {
+      return nodes.size();
+    }
+    std::size_t bytes() const {
+      return nodes.capacity() * sizeof(CompactNode);
+    }
+
+    // traverse tree, using fold expression over member pointers (cleft, cright)
+    template<typename... TP>
+    std::uint32_t traverse(std::uint32_t i, TP... paths) const {
+      ((i = nodes[i] .* paths), ...);
+      return i;
+    }
+    // same, stopping with none at a missing child
+    template<typename... TP>
+    std::uint32_t traverse_safe(std::uint32_t i, TP... paths) const {
+      ((i = i != CompactNode::none ? nodes[i] .* paths : i), ...);
+      return i;
+    }
+
+    void relayout(Layout layout); // reorder nodes (drops unreachable ones)
+};
+
+inline void CompactTree::relayout (Layout layout)
+{
+  auto order = layoutOrder(rootIndex, layout, [&](std::uint32_t i) {
+    return std::pair(nodes[i].left, nodes[i].right);
+  });
+  std::vector<std::uint32_t> position(nodes.size(), CompactNode::none);
+  for (std::size_t p = 0; p < order.size(); ++p) {
+    position[order[p]] = static_cast<std::uint32_t>(p);
+  }
+  auto moved = [&](std::uint32_t i) {
+    return i != CompactNode::none ? position[i] : i;
+  };
+  std::vector<CompactNode> relaid;
+  relaid.reserve(order.size());
+  for (auto i : order) {
+    CompactNode& n = relaid.emplace_back(nodes[i].value);
+    n.left = moved(nodes[i].left);
+    n.right = moved(nodes[i].right);
+  }
+  rootIndex = relaid.empty() ? CompactNode::none : 0;
+  nodes.swap(relaid);
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "printasync.hpp"
+
+// caller-side latency of every call, in nanoseconds
+template<typename Print>
+std::vector<double> latencies (long records, Print print)
+{
+  std::vector<double> ns;
+  ns.reserve(records);
+  std::string user = "alice";
+  for (long i = 0; i < records; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    print("request", i, "from", user, "took", 0.25 * (i % 100), "ms");
+    std::chrono::duration<double,std::nano> d = std::chrono::steady_clock::now() - start;
+    ns.push_back(d.count());
+  }
+  return ns;
+}
+
+void report (char const* name, std::vector<double> ns)
+{
+  std::sort(ns.begin(), ns.end());
+  auto at = [&](double q) {
+    return ns[static_cast<std::size_t>(q * (ns.size() - 1))];
+  };
+  std::cerr << name << ": p50 " << at(0.5) << " ns, p99 " << at(0.99)
+            << " ns, p999 " << at(0.999) << " ns, max " << ns.back() << " ns\n";
+}
+
+// run with stdout redirected, e.g. ./printasync 1000000 > /dev/null
+int main(int argc, char* argv[])
+{
+  long records = argc > 1 ? std::stol(argv[1]) : 1'000'000;
+
+  // several threads may log concurrently; each has its own ring buffer
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < 3; ++i) {
+        printAsync("thread", t, "message", i);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  AsyncLog::instance().flush();
+
+  report("synchronous print", latencies(records, [](auto const&... args) {
+    print(args...);
+  }));
+  std::cout.flush();
+  report("async print (block)", latencies(records, [](auto const&... args) {
+    printAsync(args...);
+  }));
+  AsyncLog::instance().flush();
+  AsyncLog::instance().setOverflow(AsyncLog::Overflow::drop);
+  report("async print (drop)", latencies(records, [](auto const&... args) {
+    printAsync(args...);
+  }));
+  AsyncLog::instance().flush();
+  std::cerr << "dropped records: " << AsyncLog::instance().dropped() << '\n';
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "printbuf.hpp"
+
+// asynchronous print(): the calling thread only copies the arguments in
+// binary form into its own ring buffer; a background thread formats them
+// (like addspace.hpp: each argument followed by a space) and writes them
+class AsyncLog {
+  public:
+    enum class Overflow {
+      drop,                       // full buffer: discard the record
+      block                       // full buffer: wait for the background thread
+    };
+    // larger records (encoded arguments plus a 16-byte header) are always
+    // discarded, whatever the Overflow setting, and counted in dropped()
+    static constexpr std::size_t maxRecordSize = std::size_t(1) << 15;
+
+    static AsyncLog& instance() {
+      static AsyncLog log;
+      return log;
+    }
+    AsyncLog(AsyncLog const&) = delete;
+    AsyncLog& operator= (AsyncLog const&) = delete;
+    ~AsyncLog();
+
+    void setOverflow(Overflow o) {
+      overflow.store(o, std::memory_order_relaxed);
+    }
+    std::size_t dropped() const { // number of records discarded so far
+      return numDropped.load(std::memory_order_relaxed);
+    }
+
+    template<typename... Args>
+    bool print(Args const&... args);  // false if the record was dropped
+                                      // (buffer full or record too large)
+    void flush();                 // wait until all records so far are written
+
+  private:
+    // arguments travel as themselves (numbers) or as length + characters
+    template<typename T>
+    using Wire = std::conditional_t<std::is_arithmetic_v<T>, T, std::string_view>;
+    using Decoder = void (*)(char const* payload, FormatBuffer<8192>& out);
+
+    struct Header {
+      std::uint64_t size;         // of the whole record, header included
+      Decoder decode;             // nullptr: padding up to the buffer end
+    };
+    static constexpr std::size_t align = sizeof(Header);
+
+    // single-producer/single-consumer byte ring; positions only grow
+    struct Ring {
+      static constexpr std::size_t capacity = 2 * maxRecordSize;
+      alignas(64) std::atomic<std::size_t> head{0};   // next byte to consume
+      alignas(64) std::atomic<std::size_t> tail{0};   // next byte to produce
+      std::atomic<bool> closed{false};                // owner thread ended
+      alignas(Header) char data[capacity];
+    };
+    struct RingOwner {            // closes the ring when its thread ends
+      std::shared_ptr<Ring> ring;
+      ~RingOwner() {
+        if (ring) {
+          ring->closed.store(true, std::memory_order_release);
+        }
+      }
+    };
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<Ring>> rings;         // one per logging thread
+    std::atomic<Overflow> overflow{Overflow::block};
+    std::atomic<std::size_t> numDropped{0};
+    std::atomic<std::uint64_t> flushRequested{0};
+    std::atomic<std::uint64_t> flushDone{0};
+    std::atomic<bool> stop{false};
+    std::thread backend;
+
+    AsyncLog() : backend([this] { run(); }) {
+    }
+    Ring& threadRing();
+    char* reserve(Ring& ring, std::size_t size, std::size_t& end);
+    bool drain(Ring& ring, FormatBuffer<8192>& out);  // false: nothing to do
+    void run();                   // background thread
+
+    template<typename T>
+    static std::size_t encodedSize(T const& value);
+    template<typename T>
+    static char* encode(char* p, T const& value);
+    template<typename... Args>
+    static void decode(char const* p, FormatBuffer<8192>& out);
+};
+
+inline AsyncLog::~AsyncLog()
+{
+  stop.store(true, std::memory_order_release);
+  backend.join();                 // writes everything still buffered
+}
+
+template<typename... Args>
+bool AsyncLog::print (Args const&... args)
+{
+  static_assert(((std::is_arithmetic_v<Args>
+                  || std::is_convertible_v<Args const&, std::string_view>) && ...),
+                "asynchronous print supports numbers and strings only");
+  std::size_t size = sizeof(Header) + (encodedSize(args) + ... + 0);
+  size = (size + align - 1) / align * align;
+  Ring& ring = threadRing();
+  std::size_t end;
+  char* p = reserve(ring, size, end);
+  if (p == nullptr) {
+    numDropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  Header h{size, &decode<Wire<Args>...>};
+  std::memcpy(p, &h, sizeof(h));
+  char* q = p + sizeof(h);
+  ((q = encode(q, args)), ...);
+  ring.tail.store(end, std::memory_order_release);   // publish record
+  return true;
+}
+
+inline void AsyncLog::flush ()
+{
+  std::uint64_t target = flushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+  while (flushDone.load(std::memory_order_acquire) < target) {
+    std::this_thread::yield();
+  }
+}
+
+inline AsyncLog::Ring& AsyncLog::threadRing ()
+{
+  thread_local RingOwner owner;
+  if (!owner.ring) {
+    owner.ring = std::make_shared<Ring>();
+    std::lock_guard<std::mutex> lg(ringsMutex);
+    rings.push_back(owner.ring);
+  }
+  return *owner.ring;
+}
+
+// returns contiguous space for size bytes (nullptr: dropped) and the tail
+// position after it; if the space left before the end of the buffer is too
+// small, it becomes padding and the record starts at 0
+inline char* AsyncLog::reserve (Ring& ring, std::size_t size, std::size_t& end)
+{
+  if (size > maxRecordSize) {
+    return nullptr;               // never fits reliably, even when blocking
+  }
+  std::size_t tail = ring.tail.load(std::memory_order_relaxed);
+  std::size_t offset = tail % Ring::capacity;
+  std::size_t padding = Ring::capacity - offset < size ? Ring::capacity - offset : 0;
+  while (Ring::capacity - (tail - ring.head.load(std::memory_order_acquire))
+         < padding + size) {
+    if (overflow.load(std::memory_order_relaxed) == Overflow::drop) {
+      return nullptr;
+    }
+    std::this_thread::yield();    // wait for the background thread
+  }
+  end = tail + padding + size;
+  if (padding > 0) {
+    Header h{padding, nullptr};
+    std::memcpy(ring.data + offset, &h, sizeof(h));
+    return ring.data;
+  }
+  return ring.data + offset;
+}
+
+inline bool AsyncLog::drain (Ring& ring, FormatBuffer<8192>& out)
+{
+  std::size_t head = ring.head.load(std::memory_order_relaxed);
+  std::size_t tail = ring.tail.load(std::memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+  while (head != tail) {
+    Header h;
+    char const* p = ring.data + head % Ring::capacity;
+    std::memcpy(&h, p, sizeof(h));
+    if (h.decode != nullptr) {
+      h.decode(p + sizeof(h), out);
+    }
+    head += h.size;
+  }
+  ring.head.store(head, std::memory_order_release);
+  return true;
+}
+
+inline void AsyncLog::run ()
+{
+  FormatBuffer<8192> out(std::cout);
+  std::vector<std::shared_ptr<Ring>> current;
+  for (;;) {
+    std::uint64_t flushTarget = flushRequested.load(std::memory_order_acquire);
+    bool stopping = stop.load(std::memory_order_acquire);
+    {
+      std::lock_guard<std::mutex> lg(ringsMutex);
+      current = rings;
+    }
+    bool busy = false;
+    for (auto& ring : current) {
+      busy |= drain(*ring, out);
+    }
+    // everything logged before flushTarget/stopping was read is formatted now
+    if (!busy || flushTarget != flushDone.load(std::memory_order_relaxed)) {
+      out.flush();
+      std::cout.flush();
+      flushDone.store(flushTarget, std::memory_order_release);
+    }
+    if (busy) {
+      continue;
+    }
+    if (stopping) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lg(ringsMutex);
+      for (auto it = rings.begin(); it != rings.end(); ) {
+        bool finished = (*it)->closed.load(std::memory_order_acquire)
+          && (*it)->head.load() == (*it)->tail.load(std::memory_order_acquire);
+        it = finished ? rings.erase(it) : it + 1;
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+template<typename T>
+std::size_t AsyncLog::encodedSize (T const& value)
+{
+  if constexpr (std::is_arithmetic_v<T>) {
+    return sizeof(T);
+  }
+  else {
+    return sizeof(std::uint32_t) + std::string_view(value).size();
+  }
+}
+
+template<typename T>
+char* AsyncLog::encode (char* p, T const& value)
+{
+  if constexpr (std::is_arithmetic_v<T>) {
+    std::memcpy(p, &value, sizeof(T));
+    return p + sizeof(T);
+  }
+  else {
+    std::string_view s(value);
+    auto len = static_cast<std::uint32_t>(s.size());
+    std::memcpy(p, &len, sizeof(len));
+    std::memcpy(p + sizeof(len), s.data(), len);
+    return p + sizeof(len) + len;
+  }
+}
+
+template<typename... Args>
+void AsyncLog::decode (char const* p, FormatBuffer<8192>& out)
+{
+  auto next = [&](auto tag) {
+    using T = typename decltype(tag)::type;
+    if constexpr (std::is_arithmetic_v<T>) {
+      T value;
+      std::memcpy(&value, p, sizeof(T));
+      p += sizeof(T);
+      out.append(value);
+    }
+    else {
+      std::uint32_t len;
+      std::memcpy(&len, p, sizeof(len));
+      out.append(p + sizeof(len), len);
+      p += sizeof(len) + len;
+    }
+    out.append(' ');
+  };
+  (next(std::type_identity<Args>{}), ...);
+  out.append('\n');
+}
+
+// print all arguments in one line without waiting for the output
+template<typename... Args>
+bool printAsync (Args const&... args)
+{
+  return AsyncLog::instance().print(args...);
+}
@@ -0,0 +1,45 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// fold::print() and recursive::print(): the per-argument ostream versions
+// of print() to compare with
+#include "addspace.hpp"
+#include "varprint2.hpp"
+#include "printbuf.hpp"
+
+// log records records; returns lines per second
+template<typename Print>
+double logLines (long records, Print print)
+{
+  std::string user = "alice";
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < records; ++i) {
+    print("request", i, "from", user, "took", 0.25 * (i % 100), "ms");
+  }
+  std::cout.flush();
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  return records / d.count();
+}
+
+// run with stdout redirected, e.g. ./printbuf 10000000 > /dev/null
+int main(int argc, char* argv[])
+{
+  long records = argc > 1 ? std::stol(argv[1]) : 10'000'000;
+
+  print("hello", 42, 3.5, 'x', std::string("world"));
+
+  double buffered = logLines(records, [](auto const&... args) {
+    print(args...);
+  });
+  double addSpace = logLines(records, [](auto const&... args) {
+    fold::print(args...);
+  });
+  double perLine = logLines(records, [](auto const&... args) {
+    recursive::print(args...);
+  });
+  std::cerr << "buffered print: " << buffered << " lines/s\n"
+            << "AddSpace fold print: " << addSpace << " lines/s\n"
+            << "recursive print (one line per argument): " << perLine
+            << " records/s\n";
+}
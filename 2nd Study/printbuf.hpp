@@ -0,0 +1,113 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+
+// collects formatted output in a fixed buffer and writes it to the stream
+// in one go (or in Size-sized pieces if the output doesn't fit)
+template<std::size_t Size = 512>
+class FormatBuffer {
+    static_assert(Size >= 64, "buffer must hold any formatted number");
+  private:
+    char buf[Size];               // formatted, not yet written characters
+    std::size_t len = 0;          // number of characters in buf
+    std::ostream& os;             // where flush() writes to
+  public:
+    explicit FormatBuffer(std::ostream& out) : os(out) {
+    }
+    FormatBuffer(FormatBuffer const&) = delete;
+    FormatBuffer& operator= (FormatBuffer const&) = delete;
+    ~FormatBuffer() {
+      flush();
+    }
+
+    void append(char c) {
+      if (len == Size) {
+        flush();
+      }
+      buf[len++] = c;
+    }
+    void append(char const* s, std::size_t n);
+    template<typename T>
+    void append(T const& value);  // format value like operator<< would
+
+    void flush() {                // write buffered characters
+      if (len > 0) {
+        os.write(buf, static_cast<std::streamsize>(len));
+        len = 0;
+      }
+    }
+    std::string_view view() const {  // buffered characters
+      return {buf, len};
+    }
+};
+
+template<std::size_t Size>
+void FormatBuffer<Size>::append (char const* s, std::size_t n)
+{
+  while (n > Size - len) {        // fill up, write out, continue
+    std::size_t part = Size - len;
+    std::memcpy(buf + len, s, part);
+    len = Size;
+    flush();
+    s += part;
+    n -= part;
+  }
+  std::memcpy(buf + len, s, n);
+  len += n;
+}
+
+template<std::size_t Size>
+template<typename T>
+void FormatBuffer<Size>::append (T const& value)
+{
+  if constexpr (std::is_same_v<T, bool>) {
+    append(value ? '1' : '0');
+  }
+  else if constexpr (std::is_same_v<T, signed char>
+                     || std::is_same_v<T, unsigned char>) {
+    append(static_cast<char>(value));
+  }
+  else if constexpr (std::is_arithmetic_v<T>) {
+    // numbers are converted in place with to_chars (no locale, no sentry);
+    // floating-point values use the shortest round-trip representation
+    if (Size - len < 64) {
+      flush();
+    }
+    auto [end, ec] = std::to_chars(buf + len, buf + Size, value);
+    len = static_cast<std::size_t>(end - buf);
+  }
+  else if constexpr (std::is_convertible_v<T const&, std::string_view>) {
+    std::string_view s = value;
+    append(s.data(), s.size());
+  }
+  else {
+    // any other type: fall back to its output operator
+    std::ostringstream tmp;
+    tmp << value;
+    std::string s = tmp.str();
+    append(s.data(), s.size());
+  }
+}
+
+// format all arguments into buf, each followed by a space (as in addspace.hpp)
+template<std::size_t Size, typename... Args>
+void format_to (FormatBuffer<Size>& buf, Args const&... args)
+{
+  ( (buf.append(args), buf.append(' ')), ... );
+}
+
+// print all arguments in one line with a single write to std::cout
+template<typename... Args>
+void print (Args const&... args)
+{
+  FormatBuffer<> buf(std::cout);
+  format_to(buf, args...);
+  buf.append('\n');
+  buf.flush();
+}
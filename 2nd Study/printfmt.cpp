@@ -0,0 +1,51 @@
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "printfmt.hpp"
+
+// shortest round-trip text of a number, as print() writes it
+// (std::to_string(0.25) would give "0.250000")
+template<typename T>
+std::string toChars (T value)
+{
+  char buf[64];
+  auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+  return std::string(buf, end);
+}
+
+// log records records; returns lines per second
+template<typename Print>
+double logLines (long records, Print print)
+{
+  std::string user = "alice";
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < records; ++i) {
+    print(i, user, 0.25 * (i % 100));
+  }
+  std::cout.flush();
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  return records / d.count();
+}
+
+// run with stdout redirected, e.g. ./printfmt 10000000 > /dev/null
+int main(int argc, char* argv[])
+{
+  long records = argc > 1 ? std::stol(argv[1]) : 10'000'000;
+
+  print<"{} + {} = {}">(1, 2, 1 + 2);
+  print<"{{literal braces}} and {}">(std::string("text"));
+  // print<"{} {}">(1);           // ERROR: number of {} differs from arguments
+  // print<"{x}">(1);             // ERROR: only {} placeholders are supported
+
+  double formatted = logLines(records, [](auto const&... args) {
+    print<"request {} from {} took {} ms">(args...);
+  });
+  double concatenated = logLines(records, [](auto const& i, auto const& user,
+                                             auto const& ms) {
+    std::cout << ("request " + toChars(i) + " from " + user + " took "
+                  + toChars(ms) + " ms\n");
+  });
+  std::cerr << "compile-time format: " << formatted << " lines/s\n"
+            << "string concatenation: " << concatenated << " lines/s\n";
+}
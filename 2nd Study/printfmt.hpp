@@ -0,0 +1,162 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "printbuf.hpp"
+
+// string literal usable as template argument: print<"x = {}">(x)
+template<std::size_t N>
+struct FormatString {
+  char chars[N];                  // characters including the terminating null
+  constexpr FormatString(char const (&s)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+      chars[i] = s[i];
+    }
+  }
+  constexpr std::size_t size() const {
+    return N - 1;
+  }
+};
+
+// a step of the output: literal text, or the argument with index arg
+struct FormatSegment {
+  static constexpr std::size_t literal = ~std::size_t(0);
+  std::size_t arg = literal;
+  std::size_t begin = 0;          // literal text: chars[begin, begin+len)
+  std::size_t len = 0;
+};
+
+enum class FormatError { none, unmatchedOpen, unmatchedClose, badPlaceholder };
+
+// the format string, parsed at compile time; "{}" is an argument, "{{" and
+// "}}" are literal braces
+template<FormatString Fmt>
+class ParsedFormat {
+  private:
+    // calls step(segment) for every segment; returns the first error found
+    template<typename Step>
+    static constexpr FormatError scan(Step step) {
+      std::size_t args = 0;
+      std::size_t begin = 0;      // start of pending literal text
+      std::size_t i = 0;
+      auto literalUntil = [&](std::size_t end) {
+        if (end > begin) {
+          step(FormatSegment{FormatSegment::literal, begin, end - begin});
+        }
+      };
+      while (i < Fmt.size()) {
+        char c = Fmt.chars[i];
+        if (c != '{' && c != '}') {
+          ++i;
+          continue;
+        }
+        bool doubled = i + 1 < Fmt.size() && Fmt.chars[i+1] == c;
+        if (doubled) {            // "{{" or "}}": keep one brace as text
+          literalUntil(i + 1);
+          begin = i += 2;
+        }
+        else if (c == '}') {
+          return FormatError::unmatchedClose;
+        }
+        else if (i + 1 == Fmt.size()) {
+          return FormatError::unmatchedOpen;
+        }
+        else if (Fmt.chars[i+1] != '}') {
+          return FormatError::badPlaceholder;   // only plain {} is supported
+        }
+        else {
+          literalUntil(i);
+          step(FormatSegment{args++, 0, 0});
+          begin = i += 2;
+        }
+      }
+      literalUntil(i);
+      return FormatError::none;
+    }
+
+    static constexpr std::size_t countSegments() {
+      std::size_t n = 0;
+      scan([&](FormatSegment) { ++n; });
+      return n;
+    }
+
+  public:
+    static constexpr FormatError error = scan([](FormatSegment) {});
+    static constexpr std::size_t numSegments = countSegments();
+    static constexpr std::array<FormatSegment,numSegments> segments = [] {
+      std::array<FormatSegment,numSegments> result{};
+      std::size_t n = 0;
+      scan([&](FormatSegment s) { result[n++] = s; });
+      return result;
+    }();
+    static constexpr std::size_t numArgs = [] {
+      std::size_t n = 0;
+      for (auto const& s : segments) {
+        n += s.arg != FormatSegment::literal;
+      }
+      return n;
+    }();
+};
+
+// whether FormatBuffer<>::append() can output a T
+template<typename T>
+constexpr bool isFormattable = std::is_arithmetic_v<T>
+  || std::is_convertible_v<T const&, std::string_view>
+  || requires(std::ostream& os, T const& value) { os << value; };
+
+template<FormatString Fmt, std::size_t I, std::size_t Size, typename Args>
+void formatSegment (FormatBuffer<Size>& buf, Args const& args)
+{
+  constexpr FormatSegment s = ParsedFormat<Fmt>::segments[I];
+  if constexpr (s.arg == FormatSegment::literal) {
+    buf.append(Fmt.chars + s.begin, s.len);
+  }
+  else {
+    buf.append(std::get<s.arg>(args));
+  }
+}
+
+template<FormatString Fmt, std::size_t Size, typename Args, std::size_t... I>
+void formatSegments (FormatBuffer<Size>& buf, Args const& args,
+                     std::index_sequence<I...>)
+{
+  ( formatSegment<Fmt,I>(buf, args), ... );
+}
+
+// format args into buf as described by Fmt; no parsing at run time
+template<FormatString Fmt, std::size_t Size, typename... Args>
+void format_to (FormatBuffer<Size>& buf, Args const&... args)
+{
+  using Parsed = ParsedFormat<Fmt>;
+  static_assert(Parsed::error != FormatError::unmatchedOpen,
+                "format string: '{' without matching '}'");
+  static_assert(Parsed::error != FormatError::unmatchedClose,
+                "format string: '}' without matching '{' (use '}}')");
+  static_assert(Parsed::error != FormatError::badPlaceholder,
+                "format string: only {} placeholders are supported (use '{{')");
+  if constexpr (Parsed::error == FormatError::none) {
+    static_assert(Parsed::numArgs == sizeof...(Args),
+                  "format string: number of {} differs from number of arguments");
+    static_assert((isFormattable<Args> && ...),
+                  "argument type can't be printed");
+    if constexpr (Parsed::numArgs == sizeof...(Args)) {
+      formatSegments<Fmt>(buf, std::forward_as_tuple(args...),
+                          std::make_index_sequence<Parsed::numSegments>{});
+    }
+  }
+}
+
+// print formatted line with a single write to std::cout
+template<FormatString Fmt, typename... Args>
+void print (Args const&... args)
+{
+  FormatBuffer<> buf(std::cout);
+  format_to<Fmt>(buf, args...);
+  buf.append('\n');
+  buf.flush();
+}
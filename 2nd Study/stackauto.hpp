@@ -1,24 +1,63 @@
-#include <array>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../11th Study/policy-traits/read-only-param.hpp"
+
+// smallest unsigned integral type that can hold values up to Max
+template<auto Max>
+using SmallestUint = std::conditional_t<(Max <= 0xFFu), std::uint8_t,
+                     std::conditional_t<(Max <= 0xFFFFu), std::uint16_t,
+                     std::conditional_t<(Max <= 0xFFFFFFFFu), std::uint32_t,
+                                        std::uint64_t>>>;
 
 template<typename T, auto Maxsize>
 class Stack {
   public:
     using size_type = decltype(Maxsize);
   private:
-    std::array<T,Maxsize> elems;  // elements
-    size_type numElems;           // current number of elements
+    using counter_type = SmallestUint<Maxsize>;  // as narrow as Maxsize allows
+    alignas(T) unsigned char elems[Maxsize * sizeof(T)];  // raw element storage
+    counter_type numElems;        // current number of elements (after elems,
+                                  // so it only pads up to alignof(T))
   public:
     Stack();                      // constructor
-    void push(T const& elem);     // push element
+    Stack(Stack const& other);    // copy constructor
+    Stack(Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    Stack& operator= (Stack const& other);
+    Stack& operator= (Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~Stack();                     // destructor
+
+    using param_type = read_only_param_t<T>;  // T or T const&
+    void push(param_type elem);   // push element
+    void push(T&& elem)           // push element by moving it
+      requires (!std::is_same_v<param_type, T>);
+    template<typename... Args>
+    T& emplace(Args&&... args);   // construct element on top in place
     void pop();                   // pop element
     T const& top() const;         // return top element
     bool empty() const {          // return whether the stack is empty
       return numElems == 0;
     }
     size_type size() const {      // return current number of elements
-      return numElems;
+      return static_cast<size_type>(numElems);
+    }
+  private:
+    T* slots() {                  // raw storage: no launder, may hold no T yet
+      return reinterpret_cast<T*>(elems);
+    }
+    T const* slots() const {
+      return reinterpret_cast<T const*>(elems);
     }
+    T* data() {                   // live elements elems[0..numElems)
+      return numElems != 0 ? std::launder(slots()) : slots();
+    }
+    T const* data() const {
+      return numElems != 0 ? std::launder(slots()) : slots();
+    }
+    void clear();                 // destroy all elements
 };
 
 // constructor
@@ -26,28 +65,97 @@ template<typename T, auto Maxsize>
 Stack<T,Maxsize>::Stack ()
   : numElems(0)                   // start with no elements
 {
-  // nothing else to do
+  // nothing else to do: elements are constructed on push
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::Stack (Stack const& other)
+  : numElems(0)
+{
+  std::uninitialized_copy(other.data(), other.data() + other.numElems, slots());
+  numElems = other.numElems;
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::Stack (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
+  : numElems(0)
+{
+  std::uninitialized_move(other.data(), other.data() + other.numElems, slots());
+  numElems = other.numElems;
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack const& other)
+{
+  if (this != &other) {
+    clear();
+    std::uninitialized_copy(other.data(), other.data() + other.numElems, slots());
+    numElems = other.numElems;
+  }
+  return *this;
 }
 
 template<typename T, auto Maxsize>
-void Stack<T,Maxsize>::push (T const& elem)
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
 {
-  assert(numElems < Maxsize);
-  elems[numElems] = elem;         // append element
+  if (this != &other) {
+    clear();
+    std::uninitialized_move(other.data(), other.data() + other.numElems, slots());
+    numElems = other.numElems;
+  }
+  return *this;
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::~Stack ()
+{
+  clear();
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::push (param_type elem)
+{
+  emplace(elem);
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::push (T&& elem)
+  requires (!std::is_same_v<param_type, T>)
+{
+  emplace(std::move(elem));
+}
+
+template<typename T, auto Maxsize>
+template<typename... Args>
+T& Stack<T,Maxsize>::emplace (Args&&... args)
+{
+  assert(numElems < static_cast<counter_type>(Maxsize));
+  T* elem = ::new (static_cast<void*>(slots() + numElems))
+              T(std::forward<Args>(args)...);   // append element
   ++numElems;                     // increment number of elements
+  return *elem;
 }
 
 template<typename T, auto Maxsize>
 void Stack<T,Maxsize>::pop ()
 {
-  assert(!elems.empty());
+  assert(!empty());
+  std::destroy_at(std::launder(slots() + (numElems - 1)));
   --numElems;                     // decrement number of elements
 }
 
 template<typename T, auto Maxsize>
 T const& Stack<T,Maxsize>::top () const
 {
-  assert(!elems.empty());
-  return elems[numElems-1];       // return last element
+  assert(!empty());
+  return *std::launder(slots() + (numElems - 1));  // return last element
 }
 
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::clear ()
+{
+  std::destroy(data(), data() + numElems);
+  numElems = 0;
+}
@@ -0,0 +1,59 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "stacknontype.hpp"
+
+// move bursts of burst elements from one stack to another and back,
+// repeated rounds times; returns million elements per second
+template<typename Transfer>
+double transfer (std::size_t burst, int rounds, Transfer move)
+{
+  using IntStack = Stack<int,4096>;
+  auto from = std::make_unique<IntStack>();
+  auto to = std::make_unique<IntStack>();
+  std::vector<int> init(burst);
+  std::iota(init.begin(), init.end(), 0);
+  from->push_range(init);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; ++r) {
+    move(*from, *to, burst);
+    move(*to, *from, burst);
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  if (from->top() == 42) {        // keep the loop from being optimized away
+    std::cout << ' ';
+  }
+  return 2.0 * burst * rounds / d.count() / 1e6;
+}
+
+int main()
+{
+  Stack<std::string,8> stringStack;
+  std::string words[] = {"a", "bulk", "push"};
+  stringStack.push_range(words);
+  std::string popped[2];
+  stringStack.pop_n(popped);
+  std::cout << popped[0] << ' ' << popped[1] << ", left: "
+            << stringStack.view().size() << '\n';
+
+  // benchmark 1K-item bursts: element-wise loop vs. pop_n + push_range
+  constexpr std::size_t burst = 1024;
+  auto perElement = [](auto& from, auto& to, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+      to.push(from.top());
+      from.pop();
+    }
+  };
+  auto bulk = [buf = std::vector<int>(burst)](auto& from, auto& to,
+                                              std::size_t n) mutable {
+    from.pop_n(std::span<int>(buf.data(), n));
+    to.push_range(std::span<int const>(buf.data(), n));
+  };
+  std::cout << "per element: " << transfer(burst, 200000, perElement)
+            << " M elems/s, bulk: " << transfer(burst, 200000, bulk)
+            << " M elems/s\n";
+}
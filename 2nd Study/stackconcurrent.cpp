@@ -0,0 +1,116 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "stackauto.hpp"
+#include "stackconcurrent.hpp"
+
+// the fixed-capacity Stack<> shared behind a mutex
+template<typename T, auto Maxsize>
+class LockedStack {
+  private:
+    std::mutex mutex;
+    Stack<T,Maxsize> stack;
+  public:
+    bool push(T const& elem) {
+      std::lock_guard<std::mutex> lg(mutex);
+      if (stack.size() == Maxsize) {
+        return false;
+      }
+      stack.push(elem);
+      return true;
+    }
+    std::optional<T> pop() {
+      std::lock_guard<std::mutex> lg(mutex);
+      if (stack.empty()) {
+        return std::nullopt;
+      }
+      T elem = stack.top();
+      stack.pop();
+      return elem;
+    }
+};
+
+// producers push distinct values, consumers pop until all were seen once
+template<typename S>
+bool stress (int producers, int consumers, int perProducer)
+{
+  auto s = std::make_unique<S>();
+  std::vector<std::atomic<int>> seen(producers * perProducer);
+  std::atomic<int> popped{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < perProducer; ++i) {
+        while (!s->push(p * perProducer + i)) {
+          std::this_thread::yield();  // full
+        }
+      }
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      while (popped.load() < producers * perProducer) {
+        if (auto v = s->pop()) {
+          seen[*v].fetch_add(1);
+          popped.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (auto& count : seen) {
+    if (count.load() != 1) {
+      return false;
+    }
+  }
+  return !s->pop();
+}
+
+// each thread alternates push and pop; returns million operations per second
+template<typename S>
+double throughput (int numThreads, int opsPerThread)
+{
+  auto s = std::make_unique<S>();
+  std::vector<std::thread> threads;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < opsPerThread / 2; ++i) {
+        s->push(t);
+        s->pop();
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  return double(numThreads) * opsPerThread / d.count() / 1e6;
+}
+
+int main()
+{
+  constexpr auto capacity = 1024u;
+  using LockFree = ConcurrentStack<int,capacity>;
+  using Eliminating = ConcurrentStack<int,capacity,16>;
+  using Locked = LockedStack<int,capacity>;
+
+  std::cout << std::boolalpha
+            << "stress lock-free: " << stress<LockFree>(4, 4, 200000) << '\n'
+            << "stress elimination: " << stress<Eliminating>(4, 4, 200000) << '\n'
+            << "stress mutex: " << stress<Locked>(4, 4, 200000) << '\n';
+
+  for (int n : {1, 2, 4, 8, 16, 32}) {
+    int ops = 4'000'000 / n;
+    std::cout << n << " threads: lock-free " << throughput<LockFree>(n, ops)
+              << " Mops/s, elimination " << throughput<Eliminating>(n, ops)
+              << " Mops/s, mutex " << throughput<Locked>(n, ops) << " Mops/s\n";
+  }
+}
@@ -0,0 +1,255 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+// lock-free stack of up to Maxsize elements, usable from several threads
+// - elements live in a fixed array of nodes; free and used nodes are kept in
+//   two Treiber stacks linked by node index
+// - each list head packs a modification tag with the top index, so a CAS
+//   fails if the head was popped and pushed back meanwhile (ABA protection)
+// - with EliminationSlots > 0, a push and a pop that both lose a CAS race may
+//   hand over the node through an elimination array instead of retrying
+template<typename T, auto Maxsize, std::size_t EliminationSlots = 0>
+class ConcurrentStack {
+    static_assert(Maxsize > 0 && static_cast<std::uint64_t>(Maxsize) < 0xFFFFFFFFu,
+                  "capacity must fit into a 32-bit node index");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "tagged list heads require lock-free 64-bit atomics");
+  public:
+    using size_type = decltype(Maxsize);
+  private:
+    static constexpr std::uint32_t nil = 0xFFFFFFFFu;   // end of list
+    static constexpr std::uint64_t taken = ~std::uint64_t(0);  // slot state
+
+    struct Node {
+      alignas(T) unsigned char value[sizeof(T)];  // constructed while used
+      std::atomic<std::uint32_t> next;            // next node in its list
+    };
+
+    alignas(64) std::atomic<std::uint64_t> usedList;  // tag << 32 | top used node
+    alignas(64) std::atomic<std::uint64_t> freeList;  // tag << 32 | top free node
+    // 0: empty, index+1: node offered by a push, taken: node grabbed by a pop
+    alignas(64) std::atomic<std::uint64_t> slots[EliminationSlots > 0 ? EliminationSlots : 1];
+    Node nodes[Maxsize];
+
+  public:
+    ConcurrentStack();            // constructor
+    ConcurrentStack(ConcurrentStack const&) = delete;
+    ConcurrentStack& operator= (ConcurrentStack const&) = delete;
+    ~ConcurrentStack();           // destructor
+
+    bool push(T const& elem);     // push element (false if full)
+    bool push(T&& elem);          // push element by moving it (false if full)
+    template<typename... Args>
+    bool emplace(Args&&... args); // construct element on top (false if full)
+    std::optional<T> pop();       // pop top element (nullopt if empty)
+    bool empty() const {          // return whether the stack is (was) empty
+      return index(usedList.load(std::memory_order_acquire)) == nil;
+    }
+
+  private:
+    static std::uint32_t index(std::uint64_t h) {
+      return static_cast<std::uint32_t>(h);
+    }
+    static std::uint64_t retag(std::uint64_t h, std::uint32_t idx) {
+      return ((h >> 32) + 1) << 32 | idx;
+    }
+    T* valueOf(std::uint32_t idx) {
+      return std::launder(reinterpret_cast<T*>(nodes[idx].value));
+    }
+    bool tryLink(std::atomic<std::uint64_t>& list, std::uint32_t idx);
+    bool tryUnlink(std::atomic<std::uint64_t>& list, std::uint32_t& idx);
+    void link(std::atomic<std::uint64_t>& list, std::uint32_t idx);
+    std::uint32_t unlink(std::atomic<std::uint64_t>& list);
+    bool offer(std::uint32_t idx);  // hand node to a concurrent pop
+    bool take(std::uint32_t& idx);  // grab node from a concurrent push
+    std::atomic<std::uint64_t>& randomSlot();
+    T extract(std::uint32_t idx);   // move value out and recycle node
+};
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+ConcurrentStack<T,Maxsize,EliminationSlots>::ConcurrentStack ()
+  : usedList(nil), freeList(0)    // no used nodes; all nodes are free
+{
+  std::uint32_t n = static_cast<std::uint32_t>(Maxsize);
+  for (std::uint32_t i = 0; i < n; ++i) {
+    nodes[i].next.store(i + 1 < n ? i + 1 : nil, std::memory_order_relaxed);
+  }
+  for (auto& slot : slots) {
+    slot.store(0, std::memory_order_relaxed);
+  }
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+ConcurrentStack<T,Maxsize,EliminationSlots>::~ConcurrentStack ()
+{
+  // no other thread may use the stack any more
+  for (std::uint32_t i = index(usedList.load()); i != nil; i = nodes[i].next.load()) {
+    std::destroy_at(valueOf(i));
+  }
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::push (T const& elem)
+{
+  return emplace(elem);
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::push (T&& elem)
+{
+  return emplace(std::move(elem));
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+template<typename... Args>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::emplace (Args&&... args)
+{
+  std::uint32_t idx = unlink(freeList);
+  if (idx == nil) {
+    return false;                 // full
+  }
+  try {
+    ::new (static_cast<void*>(nodes[idx].value)) T(std::forward<Args>(args)...);
+  }
+  catch (...) {
+    link(freeList, idx);
+    throw;
+  }
+  while (!tryLink(usedList, idx)) {
+    if constexpr (EliminationSlots > 0) {
+      if (offer(idx)) {
+        return true;              // a concurrent pop took the element
+      }
+    }
+  }
+  return true;
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+std::optional<T> ConcurrentStack<T,Maxsize,EliminationSlots>::pop ()
+{
+  std::uint32_t idx;
+  while (!tryUnlink(usedList, idx)) {
+    if constexpr (EliminationSlots > 0) {
+      if (take(idx)) {
+        break;                    // got the element of a concurrent push
+      }
+    }
+  }
+  if (idx == nil) {
+    return std::nullopt;          // empty
+  }
+  return extract(idx);
+}
+
+// try once to make node idx the new top of list
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::tryLink
+  (std::atomic<std::uint64_t>& list, std::uint32_t idx)
+{
+  std::uint64_t old = list.load(std::memory_order_relaxed);
+  nodes[idx].next.store(index(old), std::memory_order_relaxed);
+  return list.compare_exchange_weak(old, retag(old, idx),
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed);
+}
+
+// try once to remove the top node of list (idx is nil if the list is empty)
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::tryUnlink
+  (std::atomic<std::uint64_t>& list, std::uint32_t& idx)
+{
+  std::uint64_t old = list.load(std::memory_order_acquire);
+  idx = index(old);
+  if (idx == nil) {
+    return true;
+  }
+  // next may be stale if idx was unlinked meanwhile; the tag makes the CAS fail
+  std::uint32_t next = nodes[idx].next.load(std::memory_order_relaxed);
+  return list.compare_exchange_weak(old, retag(old, next),
+                                    std::memory_order_acquire,
+                                    std::memory_order_relaxed);
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+void ConcurrentStack<T,Maxsize,EliminationSlots>::link
+  (std::atomic<std::uint64_t>& list, std::uint32_t idx)
+{
+  while (!tryLink(list, idx)) {
+  }
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+std::uint32_t ConcurrentStack<T,Maxsize,EliminationSlots>::unlink
+  (std::atomic<std::uint64_t>& list)
+{
+  std::uint32_t idx;
+  while (!tryUnlink(list, idx)) {
+  }
+  return idx;
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::offer (std::uint32_t idx)
+{
+  std::atomic<std::uint64_t>& slot = randomSlot();
+  std::uint64_t expected = 0;
+  std::uint64_t offered = std::uint64_t(idx) + 1;
+  if (!slot.compare_exchange_strong(expected, offered, std::memory_order_release,
+                                    std::memory_order_relaxed)) {
+    return false;                 // slot in use
+  }
+  for (int spin = 0; spin < 64; ++spin) {
+    if (slot.load(std::memory_order_relaxed) == taken) {
+      break;
+    }
+  }
+  // withdraw the offer; if that fails, a pop owns the node now
+  expected = offered;
+  if (slot.compare_exchange_strong(expected, 0, std::memory_order_relaxed)) {
+    return false;
+  }
+  slot.store(0, std::memory_order_relaxed);     // release slot for others
+  return true;
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+bool ConcurrentStack<T,Maxsize,EliminationSlots>::take (std::uint32_t& idx)
+{
+  std::atomic<std::uint64_t>& slot = randomSlot();
+  std::uint64_t offered = slot.load(std::memory_order_relaxed);
+  if (offered == 0 || offered == taken
+      || !slot.compare_exchange_strong(offered, taken, std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+    return false;
+  }
+  idx = static_cast<std::uint32_t>(offered - 1);
+  return true;
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+std::atomic<std::uint64_t>& ConcurrentStack<T,Maxsize,EliminationSlots>::randomSlot ()
+{
+  thread_local std::uint32_t seed = static_cast<std::uint32_t>(
+    reinterpret_cast<std::uintptr_t>(&seed) >> 4) | 1;
+  seed ^= seed << 13;             // xorshift32
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return slots[seed % (EliminationSlots > 0 ? EliminationSlots : 1)];
+}
+
+template<typename T, auto Maxsize, std::size_t EliminationSlots>
+T ConcurrentStack<T,Maxsize,EliminationSlots>::extract (std::uint32_t idx)
+{
+  // node idx is owned exclusively by the calling thread now
+  T* value = valueOf(idx);
+  T result(std::move(*value));
+  std::destroy_at(value);
+  link(freeList, idx);
+  return result;
+}
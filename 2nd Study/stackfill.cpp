@@ -0,0 +1,72 @@
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "stacknontype.hpp"
+
+// the former layout of Stack<>: all Maxsize elements are constructed upfront
+// and push() copy-assigns into them
+template<typename T, std::size_t Maxsize>
+class ArrayStack {
+  private:
+    std::array<T,Maxsize> elems;
+    std::size_t numElems = 0;
+  public:
+    void push(T const& elem) {
+      elems[numElems] = elem;
+      ++numElems;
+    }
+    T const& top() const {
+      return elems[numElems-1];
+    }
+};
+
+// construct a stack and fill it with fill strings, repeated rounds times
+template<typename S, typename Fill>
+double constructAndFill (int rounds, Fill fill)
+{
+  auto start = std::chrono::steady_clock::now();
+  std::size_t sum = 0;
+  for (int r = 0; r < rounds; ++r) {
+    S s;
+    fill(s);
+    sum += s.top().size();
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  if (sum == 42) {                // keep the loop from being optimized away
+    std::cout << ' ';
+  }
+  return d.count() / rounds * 1e6;  // microseconds per round
+}
+
+int main()
+{
+  constexpr std::size_t N = 1024;
+  std::string value = "a string too long for the small string buffer";
+
+  for (std::size_t fill : {std::size_t(0), N / 16, N}) {
+    auto pushCopies = [&](auto& s) {
+      for (std::size_t i = 0; i < fill; ++i) {
+        s.push(value);
+      }
+      if (fill == 0) {
+        s.push("");
+      }
+    };
+    auto emplaceElems = [&](auto& s) {
+      for (std::size_t i = 0; i < fill; ++i) {
+        s.emplace(value.data(), value.size());
+      }
+      if (fill == 0) {
+        s.emplace();
+      }
+    };
+    std::cout << "fill " << fill << " of " << N << ": "
+              << "std::array " << constructAndFill<ArrayStack<std::string,N>>(20000, pushCopies)
+              << " us, raw storage push "
+              << constructAndFill<Stack<std::string,N>>(20000, pushCopies)
+              << " us, raw storage emplace "
+              << constructAndFill<Stack<std::string,N>>(20000, emplaceElems)
+              << " us\n";
+  }
+}
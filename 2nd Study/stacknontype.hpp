@@ -1,51 +1,195 @@
-#include <array>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "../11th Study/policy-traits/read-only-param.hpp"
 
 template<typename T, std::size_t Maxsize>
 class Stack {
   private:
-    std::array<T,Maxsize> elems;  // elements
-    std::size_t numElems;         // current number of elements
+    alignas(T) unsigned char elems[Maxsize * sizeof(T)];  // raw element storage
+    std::size_t numElems;       // current number of elements
 
   public:
     Stack();                    // constructor
-    void push(T const& elem);   // push element
+    Stack(Stack const& other);  // copy constructor
+    Stack(Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    Stack& operator= (Stack const& other);
+    Stack& operator= (Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~Stack();                   // destructor
+
+    using param_type = read_only_param_t<T>;  // T or T const&
+    void push(param_type elem); // push element
+    void push(T&& elem)         // push element by moving it
+      requires (!std::is_same_v<param_type, T>);
+    template<typename... Args>
+    T& emplace(Args&&... args); // construct element on top in place
     void pop();                 // pop element
     T const& top() const;       // return top element
+    void push_range(std::span<T const> src);  // push all elements of src
+    void pop_n(std::span<T> dst);   // pop dst.size() elements into dst
+    std::span<T const> view() const {  // live elements, bottom to top
+      return {data(), numElems};
+    }
     bool empty() const {        // return whether the stack is empty
       return numElems == 0;
     }
     std::size_t size() const {  // return current number of elements
       return numElems;
     }
+
+  private:
+    T* slots() {                // raw storage: no launder, may hold no T yet
+      return reinterpret_cast<T*>(elems);
+    }
+    T const* slots() const {
+      return reinterpret_cast<T const*>(elems);
+    }
+    T* data() {                 // live elements elems[0..numElems)
+      return numElems != 0 ? std::launder(slots()) : slots();
+    }
+    T const* data() const {
+      return numElems != 0 ? std::launder(slots()) : slots();
+    }
+    void clear();               // destroy all elements
 };
 
 template<typename T, std::size_t Maxsize>
 Stack<T,Maxsize>::Stack ()
   : numElems(0)                 // start with no elements
 {
-  // nothing else to do
+  // nothing else to do: elements are constructed on push
+}
+
+template<typename T, std::size_t Maxsize>
+Stack<T,Maxsize>::Stack (Stack const& other)
+  : numElems(0)
+{
+  std::uninitialized_copy(other.data(), other.data() + other.numElems, slots());
+  numElems = other.numElems;
+}
+
+template<typename T, std::size_t Maxsize>
+Stack<T,Maxsize>::Stack (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
+  : numElems(0)
+{
+  std::uninitialized_move(other.data(), other.data() + other.numElems, slots());
+  numElems = other.numElems;
+}
+
+template<typename T, std::size_t Maxsize>
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack const& other)
+{
+  if (this != &other) {
+    clear();
+    std::uninitialized_copy(other.data(), other.data() + other.numElems, slots());
+    numElems = other.numElems;
+  }
+  return *this;
+}
+
+template<typename T, std::size_t Maxsize>
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+  if (this != &other) {
+    clear();
+    std::uninitialized_move(other.data(), other.data() + other.numElems, slots());
+    numElems = other.numElems;
+  }
+  return *this;
 }
 
 template<typename T, std::size_t Maxsize>
-void Stack<T,Maxsize>::push (T const& elem)
+Stack<T,Maxsize>::~Stack ()
+{
+  clear();
+}
+
+template<typename T, std::size_t Maxsize>
+void Stack<T,Maxsize>::push (param_type elem)
+{
+  emplace(elem);
+}
+
+template<typename T, std::size_t Maxsize>
+void Stack<T,Maxsize>::push (T&& elem)
+  requires (!std::is_same_v<param_type, T>)
+{
+  emplace(std::move(elem));
+}
+
+template<typename T, std::size_t Maxsize>
+template<typename... Args>
+T& Stack<T,Maxsize>::emplace (Args&&... args)
 {
   assert(numElems < Maxsize);
-  elems[numElems] = elem;       // append element
+  T* elem = ::new (static_cast<void*>(slots() + numElems))
+              T(std::forward<Args>(args)...);   // append element
   ++numElems;                   // increment number of elements
+  return *elem;
 }
 
 template<typename T, std::size_t Maxsize>
 void Stack<T,Maxsize>::pop ()
 {
-  assert(!elems.empty());
+  assert(!empty());
+  std::destroy_at(std::launder(slots() + (numElems - 1)));
   --numElems;                   // decrement number of elements
 }
 
 template<typename T, std::size_t Maxsize>
 T const& Stack<T,Maxsize>::top () const
 {
-  assert(!elems.empty());
-  return elems[numElems-1];
+  assert(!empty());
+  return *std::launder(slots() + (numElems - 1));
 }
 
+// push src[0] first and src[src.size()-1] last, with a single capacity check
+template<typename T, std::size_t Maxsize>
+void Stack<T,Maxsize>::push_range (std::span<T const> src)
+{
+  assert(src.size() <= Maxsize - numElems);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (!src.empty()) {
+      std::memcpy(static_cast<void*>(slots() + numElems), src.data(),
+                  src.size() * sizeof(T));
+    }
+  }
+  else {
+    std::uninitialized_copy(src.begin(), src.end(), slots() + numElems);
+  }
+  numElems += src.size();
+}
+
+// pop the top dst.size() elements; dst keeps their stack order, so the former
+// top element ends up in dst.back() and push_range(dst) restores the stack
+template<typename T, std::size_t Maxsize>
+void Stack<T,Maxsize>::pop_n (std::span<T> dst)
+{
+  assert(dst.size() <= numElems);
+  if (dst.empty()) {
+    return;
+  }
+  T* first = std::launder(slots() + (numElems - dst.size()));
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memcpy(static_cast<void*>(dst.data()), first, dst.size() * sizeof(T));
+  }
+  else {
+    std::move(first, first + dst.size(), dst.begin());
+    std::destroy(first, first + dst.size());
+  }
+  numElems -= dst.size();
+}
+
+template<typename T, std::size_t Maxsize>
+void Stack<T,Maxsize>::clear ()
+{
+  std::destroy(data(), data() + numElems);
+  numElems = 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iostream>
+#include <stack>
+#include <string>
+#include <vector>
+#include "stacksbo.hpp"
+
+// push depth elements and pop them again, repeated rounds times
+template<typename S>
+double pushPop (int depth, int rounds)
+{
+  auto start = std::chrono::steady_clock::now();
+  long sum = 0;
+  for (int r = 0; r < rounds; ++r) {
+    S s;                          // fresh stack: includes any allocation
+    for (int i = 0; i < depth; ++i) {
+      s.push(i);
+    }
+    while (!s.empty()) {
+      sum += s.top();
+      s.pop();
+    }
+  }
+  std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+  if (sum == 42) {                // keep the loop from being optimized away
+    std::cout << ' ';
+  }
+  return double(depth) * rounds / d.count() / 1e6;   // Mops/s
+}
+
+int main()
+{
+  Stack<std::string,4> stringStack;   // 4 strings inline, more on the heap
+  for (int i = 0; i < 10; ++i) {
+    stringStack.push(std::to_string(i));
+  }
+  std::cout << stringStack.top() << " (inline: " << stringStack.isInline()
+            << ")\n";
+
+  // benchmark against std::stack<std::vector> below/above inline capacity
+  constexpr int inlineCapacity = 64;
+  for (int depth : {8, 32, 64, 128, 1024}) {
+    int rounds = 20'000'000 / depth;
+    double sbo = pushPop<Stack<int,inlineCapacity>>(depth, rounds);
+    double vec = pushPop<std::stack<int,std::vector<int>>>(depth, rounds);
+    std::cout << "depth " << depth << ": Stack<int," << inlineCapacity << "> "
+              << sbo << " Mops/s, std::stack<std::vector> " << vec
+              << " Mops/s\n";
+  }
+}
@@ -0,0 +1,230 @@
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../11th Study/policy-traits/read-only-param.hpp"
+
+// stack that keeps up to Maxsize elements inline and spills to the heap
+// (growing geometrically) once more elements are pushed
+template<typename T, auto Maxsize>
+class Stack {
+    static_assert(Maxsize > 0, "inline capacity must not be zero");
+  public:
+    using size_type = std::size_t;
+  private:
+    alignas(T) unsigned char buffer[Maxsize * sizeof(T)];  // inline elements
+    T* elems;                     // inline buffer or heap buffer
+    size_type numElems;           // current number of elements
+    size_type capacity;           // number of elements elems can hold
+
+  public:
+    Stack();                      // constructor
+    Stack(Stack const& other);    // copy constructor
+    Stack(Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    Stack& operator= (Stack const& other);
+    Stack& operator= (Stack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~Stack();                     // destructor
+
+    using param_type = read_only_param_t<T>;  // T or T const&
+    void push(param_type elem);   // push element
+    void push(T&& elem)           // push element by moving it
+      requires (!std::is_same_v<param_type, T>);
+    void pop();                   // pop element
+    T const& top() const;         // return top element
+    bool empty() const {          // return whether the stack is empty
+      return numElems == 0;
+    }
+    size_type size() const {      // return current number of elements
+      return numElems;
+    }
+    bool isInline() const {       // return whether no heap buffer is used
+      return elems == inlineElems();
+    }
+
+  private:
+    T* inlineElems() {            // raw storage: no launder, may hold no T yet
+      return reinterpret_cast<T*>(buffer);
+    }
+    T const* inlineElems() const {
+      return reinterpret_cast<T const*>(buffer);
+    }
+    template<typename U>
+    void emplaceBack(U&& elem);   // construct element on top
+    template<typename U>
+    void growAndPush(U&& elem);   // move to a larger heap buffer, then push
+    void clear();                 // destroy all elements
+    void release();               // give back heap buffer (if any)
+    void moveFrom(Stack& other);  // take over elements of empty-ed other
+};
+
+// constructor
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::Stack ()
+  : elems(inlineElems()), numElems(0), capacity(Maxsize)
+{
+  // nothing else to do
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::Stack (Stack const& other)
+  : Stack()
+{
+  for (size_type i = 0; i < other.numElems; ++i) {
+    push(other.elems[i]);
+  }
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::Stack (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
+  : Stack()
+{
+  moveFrom(other);
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack const& other)
+{
+  if (this != &other) {
+    clear();
+    for (size_type i = 0; i < other.numElems; ++i) {
+      push(other.elems[i]);
+    }
+  }
+  return *this;
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>& Stack<T,Maxsize>::operator= (Stack&& other)
+  noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+  if (this != &other) {
+    clear();
+    release();
+    moveFrom(other);
+  }
+  return *this;
+}
+
+template<typename T, auto Maxsize>
+Stack<T,Maxsize>::~Stack ()
+{
+  clear();
+  release();
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::push (param_type elem)
+{
+  emplaceBack(elem);
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::push (T&& elem)
+  requires (!std::is_same_v<param_type, T>)
+{
+  emplaceBack(std::move(elem));
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::pop ()
+{
+  assert(!empty());
+  --numElems;                     // decrement number of elements
+  std::destroy_at(elems + numElems);
+}
+
+template<typename T, auto Maxsize>
+T const& Stack<T,Maxsize>::top () const
+{
+  assert(!empty());
+  return *std::launder(elems + numElems - 1);  // return last element
+}
+
+template<typename T, auto Maxsize>
+template<typename U>
+void Stack<T,Maxsize>::emplaceBack (U&& elem)
+{
+  if (numElems == capacity) {
+    growAndPush(std::forward<U>(elem));
+    return;
+  }
+  ::new (static_cast<void*>(elems + numElems)) T(std::forward<U>(elem));
+  ++numElems;                     // increment number of elements
+}
+
+template<typename T, auto Maxsize>
+template<typename U>
+void Stack<T,Maxsize>::growAndPush (U&& elem)
+{
+  std::allocator<T> alloc;
+  size_type newCapacity = capacity * 2;
+  T* newElems = alloc.allocate(newCapacity);
+  try {
+    // construct the new element first: elem might refer into elems
+    ::new (static_cast<void*>(newElems + numElems)) T(std::forward<U>(elem));
+    try {
+      if constexpr (std::is_nothrow_move_constructible_v<T>
+                    || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move(elems, elems + numElems, newElems);
+      }
+      else {
+        std::uninitialized_copy(elems, elems + numElems, newElems);
+      }
+    }
+    catch (...) {
+      std::destroy_at(newElems + numElems);
+      throw;
+    }
+  }
+  catch (...) {
+    alloc.deallocate(newElems, newCapacity);
+    throw;
+  }
+  size_type n = numElems;
+  clear();
+  release();
+  elems = newElems;
+  capacity = newCapacity;
+  numElems = n + 1;
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::clear ()
+{
+  std::destroy(elems, elems + numElems);
+  numElems = 0;
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::release ()
+{
+  if (!isInline()) {
+    std::allocator<T>().deallocate(elems, capacity);
+    elems = inlineElems();
+    capacity = Maxsize;
+  }
+}
+
+template<typename T, auto Maxsize>
+void Stack<T,Maxsize>::moveFrom (Stack& other)
+{
+  assert(empty() && isInline());
+  if (other.isInline()) {
+    // inline elements can't be stolen, so move them one by one
+    std::uninitialized_move(other.elems, other.elems + other.numElems, elems);
+    numElems = other.numElems;
+    other.clear();
+  }
+  else {
+    // steal the heap buffer
+    elems = other.elems;
+    numElems = other.numElems;
+    capacity = other.capacity;
+    other.elems = other.inlineElems();
+    other.numElems = 0;
+    other.capacity = Maxsize;
+  }
+}
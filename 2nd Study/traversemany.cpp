@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+#include "foldtraverse.hpp"
+
+// parses a whole argument as a decimal count, false on anything else
+bool parseCount(char const* arg, std::size_t& value)
+{
+  char const* end = arg + std::strlen(arg);
+  auto [ptr, ec] = std::from_chars(arg, end, value);
+  return ec == std::errc() && ptr == end && ptr != arg;
+}
+
+// traversemany [nodes [lookups]]
+int main(int argc, char* argv[])
+{
+  // each lookup starts at a random node in the top startLevels levels and
+  // follows a random path of depth steps; in a complete tree of at least
+  // minNodes nodes every such path exists
+  constexpr std::size_t startLevels = 10;
+  constexpr std::size_t depth = 12;
+  constexpr std::size_t minNodes = (std::size_t(1) << (startLevels + depth)) - 1;
+  constexpr std::size_t maxNodes = std::numeric_limits<int>::max();  // Node::value
+  std::size_t numNodes = 10'000'000;
+  std::size_t lookups = 1'000'000;
+  if (argc > 3
+      || (argc > 1 && !parseCount(argv[1], numNodes))
+      || (argc > 2 && !parseCount(argv[2], lookups))
+      || numNodes < minNodes || numNodes > maxNodes
+      || lookups == 0 || lookups > std::numeric_limits<std::size_t>::max() / depth) {
+    std::cerr << "usage: " << argv[0] << " [nodes in " << minNodes << ".." << maxNodes
+              << " [lookups > 0]]\n";
+    return 1;
+  }
+
+  // complete binary tree, scattered randomly in memory
+  std::vector<Node> nodes(numNodes);
+  std::vector<std::size_t> slot(numNodes);
+  std::iota(slot.begin(), slot.end(), 0);
+  std::mt19937 rng(42);
+  std::shuffle(slot.begin(), slot.end(), rng);
+  for (std::size_t i = 0; i < numNodes; ++i) {
+    Node& n = nodes[slot[i]];
+    n.value = static_cast<int>(i);
+    n.left = 2*i+1 < numNodes ? &nodes[slot[2*i+1]] : nullptr;
+    n.right = 2*i+2 < numNodes ? &nodes[slot[2*i+2]] : nullptr;
+  }
+
+  using Step = Node* Node::*;
+  std::uniform_int_distribution<std::size_t> top(0, (std::size_t(1) << startLevels) - 2);
+  std::bernoulli_distribution goRight;
+  std::vector<Node*> roots(lookups);
+  std::vector<Step> paths(lookups * depth);
+  for (auto& r : roots) {
+    r = &nodes[slot[top(rng)]];
+  }
+  for (auto& step : paths) {
+    step = goRight(rng) ? right : left;
+  }
+
+  auto measure = [&](char const* name, auto f) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Node*> result = f();
+    std::chrono::duration<double> d = std::chrono::steady_clock::now() - start;
+    long sum = 0;
+    for (Node* n : result) {
+      sum += n != nullptr ? n->value : -1;
+    }
+    std::cout << name << ": " << d.count() * 1e9 / lookups
+              << " ns per lookup (checksum " << sum << ")\n";
+  };
+
+  // random paths, one per lookup
+  measure("traverse_path      ", [&] {
+    std::vector<Node*> out(lookups);
+    for (std::size_t i = 0; i < lookups; ++i) {
+      out[i] = traverse_path(roots[i], std::span<Step const>(&paths[i * depth], depth));
+    }
+    return out;
+  });
+  measure("traverse_paths     ", [&] {
+    std::vector<Node*> out(lookups);
+    traverse_paths(std::span<Node* const>(roots), std::span<Step const>(paths),
+                   depth, std::span<Node*>(out));
+    return out;
+  });
+
+  // one fixed path (the fold expressions need it at compile time)
+  auto path = [](auto... steps) {
+    return [=](auto traverseAll) { return traverseAll(steps...); };
+  }(left, right, right, left, left, right, left, right, right, right, left, left);
+  static_assert(12 == depth);
+  measure("traverse (fixed)   ", [&] {
+    return path([&](auto... steps) {
+      std::vector<Node*> out(lookups);
+      for (std::size_t i = 0; i < lookups; ++i) {
+        out[i] = traverse(roots[i], steps...);
+      }
+      return out;
+    });
+  });
+  measure("traverse_safe      ", [&] {
+    return path([&](auto... steps) {
+      std::vector<Node*> out(lookups);
+      for (std::size_t i = 0; i < lookups; ++i) {
+        out[i] = traverse_safe(roots[i], steps...);
+      }
+      return out;
+    });
+  });
+  measure("traverse_many      ", [&] {
+    return path([&](auto... steps) {
+      return traverse_many(roots, steps...);
+    });
+  });
+}
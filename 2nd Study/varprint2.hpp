@@ -1,5 +1,8 @@
 #include <iostream>
 
+// print() recursing over its arguments, one << per argument
+namespace recursive {
+
 template<typename T>
 void print (T arg)
 {
@@ -12,3 +15,5 @@ void print (T firstArg, Types... args)
   print(firstArg);            // call print() for the first argument
   print(args...);             // call print() for remaining arguments
 }
+
+} // namespace recursive
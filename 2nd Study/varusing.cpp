@@ -1,40 +1,14 @@
-#include <string>
 #include <unordered_set>
-
-class Customer
-{
-  private:
-    std::string name;
-  public:
-    Customer(std::string const& n) : name(n) { }
-    std::string getName() const { return name; }
-};
-
-struct CustomerEq {
-  bool operator() (Customer const& c1, Customer const& c2) const {
-    return c1.getName() == c2.getName();
-  }
-};
-
-struct CustomerHash {
-  std::size_t operator() (Customer const& c) const {
-    return std::hash<std::string>()(c.getName());
-  }
-};
-
-// define class that combiles operator() for variadic base classes:
-template<typename... Bases>
-struct Overloader : Bases...
-{
-  using Bases::operator()...; // OK since C++17
-};
+#include "varusing.hpp"
 
 int main() 
 {
-  // combine hasher and equality for customers in one type:
-  using CustomerOP = Overloader<CustomerHash,CustomerEq>;
-
   std::unordered_set<Customer,CustomerHash,CustomerEq> coll1;
-  std::unordered_set<Customer,CustoerOP,CustomerOP> coll2;
-}
+  std::unordered_set<Customer,CustomerOP,CustomerOP> coll2;
 
+  // heterogeneous lookup: no temporary Customer or std::string
+  coll2.insert(Customer{"alice"});
+  auto pos = coll2.find("alice");
+  (void)coll1;
+  (void)pos;
+}
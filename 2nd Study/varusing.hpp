@@ -0,0 +1,53 @@
+#include <functional>
+#include <string>
+#include <string_view>
+
+class Customer
+{
+  private:
+    std::string name;
+  public:
+    // explicit: a std::string key must not turn into a Customer (and an
+    // allocation) in the transparent lookups below
+    explicit Customer(std::string const& n) : name(n) { }
+    std::string const& getName() const { return name; }
+};
+
+// equality and hash also accept a plain name (is_transparent), so that
+// lookups like coll.find("alice") need neither a Customer nor a string
+struct CustomerEq {
+  using is_transparent = void;
+  bool operator() (Customer const& c1, Customer const& c2) const {
+    return c1.getName() == c2.getName();
+  }
+  bool operator() (Customer const& c, std::string_view name) const {
+    return c.getName() == name;
+  }
+  bool operator() (std::string_view name, Customer const& c) const {
+    return name == c.getName();
+  }
+};
+
+struct CustomerHash {
+  using is_transparent = void;
+  std::size_t operator() (Customer const& c) const {
+    return std::hash<std::string_view>()(c.getName());
+  }
+  std::size_t operator() (std::string_view name) const {
+    return std::hash<std::string_view>()(name);
+  }
+};
+
+// define class that combiles operator() for variadic base classes:
+template<typename... Bases>
+struct Overloader : Bases...
+{
+  using Bases::operator()...; // OK since C++17
+};
+
+// combine hasher and equality for customers in one type
+// (is_transparent of both bases would be ambiguous, so state it again):
+struct CustomerOP : Overloader<CustomerHash,CustomerEq>
+{
+  using is_transparent = void;
+};
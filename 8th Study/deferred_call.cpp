@@ -0,0 +1,104 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include "deferred_call.h"
+
+// counts every copy and move of a C
+class C {
+public:
+  static int copies;
+  static int moves;
+  C() {}
+  C(C const&) { ++copies; }
+  C(C&&) { ++moves; }
+  static void reset() { copies = moves = 0; }
+};
+int C::copies = 0;
+int C::moves = 0;
+
+char const* called = "";
+void g(C&) { called = "C&"; }
+void g(C const&) { called = "C const&"; }
+void g(C&&) { called = "C&&"; }
+
+// forwards to g() like forwardToG() of perfect_forward.cpp
+auto forwardToG = [](auto&& x) {
+  g(static_cast<decltype(x)&&>(x));
+};
+
+int failures = 0;
+
+// compares the call and the counts since the last check with the expected
+// ones (independent of NDEBUG), then resets them
+void check(char const* what, char const* expected, int copies, int moves) {
+  bool ok = std::string(called) == expected
+            && C::copies == copies && C::moves == moves;
+  std::cout << what << ": g(" << called << "), " << C::copies << " copies, "
+            << C::moves << " moves";
+  if (ok) {
+    std::cout << " (ok)" << std::endl;
+  }
+  else {
+    std::cout << " (WRONG: expected g(" << expected << "), " << copies
+              << " copies, " << moves << " moves)" << std::endl;
+    ++failures;
+  }
+  C::reset();
+  called = "";
+}
+
+int main() {
+  C v;
+  C const c;
+
+  make_deferred_call(forwardToG, v)();              // stored copy of v
+  check("v            ", "C&&", 1, 0);
+  make_deferred_call(forwardToG, c)();
+  check("c            ", "C&&", 1, 0);
+  make_deferred_call(forwardToG, C())();
+  check("C()          ", "C&&", 0, 1);
+  make_deferred_call(forwardToG, std::move(v))();
+  check("std::move(v) ", "C&&", 0, 1);
+  make_deferred_call(forwardToG, std::ref(v))();    // opt-in reference
+  check("std::ref(v)  ", "C&", 0, 0);
+  make_deferred_call(forwardToG, std::cref(c))();
+  check("std::cref(c) ", "C const&", 0, 0);
+
+  // a parameter by value takes one more move (never a copy)
+  make_deferred_call([](C) { called = "C"; }, C())();
+  check("C() to C     ", "C", 0, 2);
+
+  // lvalue calls pass the stored argument as lvalue and can be repeated
+  auto call = make_deferred_call(forwardToG, C());
+  check("stored C()   ", "", 0, 1);
+  call();
+  call();
+  check("call() twice ", "C&", 0, 0);
+
+  // moving the whole call (e.g. into a queue) moves each argument once
+  auto moved = std::move(call);
+  check("move call    ", "", 0, 1);
+  std::move(moved)();
+  check("moved call   ", "C&&", 0, 0);
+
+  // move-only arguments
+  auto sink = make_deferred_call([](std::unique_ptr<int> p) { return *p; },
+                                 std::make_unique<int>(42));
+  int sunk = std::move(sink)();
+  std::cout << "unique_ptr   : " << sunk << (sunk == 42 ? " (ok)" : " (WRONG)")
+            << std::endl;
+  failures += sunk != 42;
+
+  // empty callables and arguments take no space
+  struct Empty {};
+  auto noop = [](Empty, int) {};
+  static_assert(sizeof(make_deferred_call(noop, Empty{}, 0)) == sizeof(int), "EBCO");
+  static_assert(sizeof(make_deferred_call(forwardToG, std::ref(v))) == sizeof(C*), "EBCO");
+
+  if (failures > 0) {
+    std::cout << failures << " checks failed" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// deferred_call: forwardToG() of perfect_forward.cpp, split in two halves.
+// make_deferred_call(f, args...) captures the callable and the arguments,
+// calling the result later passes them on to f with the right value category:
+//
+//   argument              stored as   passed by std::move(call)()
+//   lvalue x              copy of x   rvalue (moved out of the copy)
+//   rvalue                moved-in    rvalue
+//   std::ref(x)           X&          lvalue x (no copy at all)
+//   std::cref(x)          X const&    const lvalue x
+//
+// so an rvalue argument is moved at most twice (into the call and into a
+// by-value parameter of f) and never copied; move-only arguments work.
+// Calling an lvalue deferred_call passes the stored arguments as lvalues
+// instead and may be repeated. Empty callables and arguments take no space
+// (EBCO).
+
+namespace deferred_detail {
+
+// std::unwrap_ref_decay_t of C++20
+template<typename T>
+struct unwrap_ref {
+  using type = T;
+};
+template<typename T>
+struct unwrap_ref<std::reference_wrapper<T>> {
+  using type = T&;
+};
+template<typename T>
+using unwrap_ref_decay_t = typename unwrap_ref<std::decay_t<T>>::type;
+
+// one stored element; empty class types become a base class
+template<std::size_t I, typename T,
+         bool = std::is_class<T>::value && std::is_empty<T>::value
+                && !std::is_final<T>::value>
+class leaf {
+  private:
+    T value;
+  public:
+    template<typename U>
+    explicit leaf(U&& u) : value(std::forward<U>(u)) {
+    }
+    T& get() {
+      return value;
+    }
+};
+
+template<std::size_t I, typename T>
+class leaf<I, T, true> : private T {
+  public:
+    template<typename U>
+    explicit leaf(U&& u) : T(std::forward<U>(u)) {
+    }
+    T& get() {
+      return *this;
+    }
+};
+
+template<typename Indices, typename... Ts>
+class storage;
+
+template<std::size_t... Is, typename... Ts>
+class storage<std::index_sequence<Is...>, Ts...> : private leaf<Is, Ts>... {
+  public:
+    template<typename... Us>
+    explicit storage(Us&&... us) : leaf<Is, Ts>(std::forward<Us>(us))... {
+    }
+    template<std::size_t I>
+    decltype(auto) get() {
+      return element<I>(*this);
+    }
+  private:
+    template<std::size_t I, typename T>
+    static T& element(leaf<I, T>& l) {  // deduces T from the index
+      return l.get();
+    }
+};
+
+} // namespace deferred_detail
+
+template<typename F, typename... Args>
+class deferred_call {
+  private:
+    // element 0 is the callable, elements 1.. are the arguments
+    using Storage = deferred_detail::storage<
+                      std::make_index_sequence<sizeof...(Args) + 1>, F, Args...>;
+    Storage elems;
+
+  public:
+    template<typename G, typename... As,
+             typename = std::enable_if_t<sizeof...(As) == sizeof...(Args)
+                          && !std::is_same<std::decay_t<G>, deferred_call>::value>>
+    explicit deferred_call(G&& g, As&&... as)
+     : elems(std::forward<G>(g), std::forward<As>(as)...) {
+    }
+
+    // call once, moving the stored arguments (references stay lvalues)
+    decltype(auto) operator() () && {
+      return invoke(std::index_sequence_for<Args...>{});
+    }
+    // call with the stored arguments as lvalues (repeatable)
+    decltype(auto) operator() () & {
+      return invokeLvalues(std::index_sequence_for<Args...>{});
+    }
+
+  private:
+    template<std::size_t... Is>
+    decltype(auto) invoke(std::index_sequence<Is...>) {
+      // Args&& is X&& for stored values and X& for stored references,
+      // like static_cast<T&&>(x) in forwardToG()
+      return elems.template get<0>()(
+               static_cast<Args&&>(elems.template get<Is + 1>())...);
+    }
+    template<std::size_t... Is>
+    decltype(auto) invokeLvalues(std::index_sequence<Is...>) {
+      return elems.template get<0>()(elems.template get<Is + 1>()...);
+    }
+};
+
+template<typename F, typename... Args>
+deferred_call<std::decay_t<F>, deferred_detail::unwrap_ref_decay_t<Args>...>
+make_deferred_call(F&& f, Args&&... args)
+{
+  return deferred_call<std::decay_t<F>,
+                       deferred_detail::unwrap_ref_decay_t<Args>...>(
+           std::forward<F>(f), std::forward<Args>(args)...);
+}
@@ -0,0 +1,59 @@
+// accum() variants of the 11th Study against std::accumulate
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "accum1.hpp"
+#include "accum4.hpp"
+
+template <typename T>
+static std::vector<T> values(size_t n)
+{
+    std::vector<T> v(n);
+    for (size_t i = 0; i < n; ++i)
+        v[i] = static_cast<T>(i % 100);
+    return v;
+}
+
+// accum1.hpp: traits pick the accumulation type (int -> long long)
+template <typename T>
+static void BM_AccumTraits(benchmark::State &state)
+{
+    auto v = values<T>((size_t)state.range(0));
+    T const *beg = v.data();   // pointers to const select accum1.hpp's accum()
+    for (auto _ : state)
+        benchmark::DoNotOptimize(accum(beg, beg + v.size()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_AccumTraits, char)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AccumTraits, int)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AccumTraits, float)->Range(1 << 10, 1 << 20);
+
+// accum4.hpp: policy-driven, multi-lane for contiguous ranges (iterators
+// select accum4.hpp's accum())
+template <typename T>
+static void BM_AccumPolicy(benchmark::State &state)
+{
+    auto v = values<T>((size_t)state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(accum(v.begin(), v.end()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_AccumPolicy, char)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AccumPolicy, int)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_AccumPolicy, float)->Range(1 << 10, 1 << 20);
+
+template <typename T>
+static void BM_StdAccumulate(benchmark::State &state)
+{
+    auto v = values<T>((size_t)state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::accumulate(v.begin(), v.end(), T{}));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StdAccumulate, char)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdAccumulate, int)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdAccumulate, float)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
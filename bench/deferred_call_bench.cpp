@@ -0,0 +1,90 @@
+// enqueue and invoke latency of deferred_call (8th Study) against
+// std::function and std::bind task queues
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "deferred_call.h"
+#include "functionptr.hpp"
+
+constexpr std::size_t batch = 256;  // tasks enqueued, then invoked in order
+
+static std::size_t processed = 0;
+
+static void process(std::string s, int n)
+{
+    processed += s.size() + (std::size_t)n;
+}
+
+// a payload beyond the small string buffer, so every copy allocates
+static std::string payload()
+{
+    return std::string(40, 'x');
+}
+
+template <typename Queue, typename Enqueue, typename Invoke>
+static void runQueue(benchmark::State &state, Enqueue enqueue, Invoke invoke)
+{
+    Queue queue;
+    queue.reserve(batch);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < batch; ++i)
+            enqueue(queue, payload(), (int)i);
+        for (auto &task : queue)
+            invoke(task);
+        queue.clear();
+        benchmark::DoNotOptimize(processed);
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)batch);
+}
+
+static void BM_StdFunctionLambda(benchmark::State &state)
+{
+    runQueue<std::vector<std::function<void()>>>(state,
+        [](auto &queue, std::string s, int n) {
+            queue.emplace_back([s = std::move(s), n]() mutable { process(std::move(s), n); });
+        },
+        [](auto &task) { task(); });
+}
+BENCHMARK(BM_StdFunctionLambda);
+
+static void BM_StdFunctionBind(benchmark::State &state)
+{
+    // std::bind passes the bound string as lvalue: one copy per call
+    runQueue<std::vector<std::function<void()>>>(state,
+        [](auto &queue, std::string s, int n) {
+            queue.emplace_back(std::bind(process, std::move(s), n));
+        },
+        [](auto &task) { task(); });
+}
+BENCHMARK(BM_StdFunctionBind);
+
+static void BM_DeferredCall(benchmark::State &state)
+{
+    using Task = decltype(make_deferred_call(&process, std::string(), 0));
+    runQueue<std::vector<Task>>(state,
+        [](auto &queue, std::string s, int n) {
+            queue.push_back(make_deferred_call(&process, std::move(s), n));
+        },
+        [](auto &task) { std::move(task)(); });
+}
+BENCHMARK(BM_DeferredCall);
+
+static void BM_DeferredCallFunctionPtr(benchmark::State &state)
+{
+    // type-erased queue of move-only tasks (13th Study), stored inline
+    runQueue<std::vector<MoveOnlyFunctionPtr<void(), 64>>>(state,
+        [](auto &queue, std::string s, int n) {
+            queue.emplace_back([call = make_deferred_call(&process, std::move(s), n)]() mutable {
+                std::move(call)();
+            });
+        },
+        [](auto &task) { task(); });
+}
+BENCHMARK(BM_DeferredCallFunctionPtr);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+// expression templates (16th Study) against operators creating temporaries
+// and a hand-written loop, for ret = 2*x + x*y
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+
+#include "SArray.hpp"
+#include "Array.hpp"
+
+static void fill(SArray<double> &x, SArray<double> &y)
+{
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        x[i] = 0.5 * (double)i;
+        y[i] = 1.0 - (double)i;
+    }
+}
+
+static void BM_ExpressionTemplates(benchmark::State &state)
+{
+    size_t n = (size_t)state.range(0);
+    Array<double> x(n), y(n), ret(n);
+    fill(x.data(), y.data());
+    for (auto _ : state)
+    {
+        ret = 2.0*x + x*y;
+        benchmark::DoNotOptimize(ret.data()[n / 2]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n);
+}
+BENCHMARK(BM_ExpressionTemplates)->Range(1 << 10, 1 << 20);
+
+static void BM_TemporaryArrays(benchmark::State &state)
+{
+    size_t n = (size_t)state.range(0);
+    SArray<double> x(n), y(n), ret(n);
+    fill(x, y);
+    for (auto _ : state)
+    {
+        SArray<double> scaled = 2.0*x;  // each operator allocates and fills an array
+        SArray<double> product = x*y;
+        ret = scaled + product;
+        benchmark::DoNotOptimize(ret[n / 2]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n);
+}
+BENCHMARK(BM_TemporaryArrays)->Range(1 << 10, 1 << 20);
+
+static void BM_HandWrittenLoop(benchmark::State &state)
+{
+    size_t n = (size_t)state.range(0);
+    std::vector<double> x(n), y(n), ret(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x[i] = 0.5 * (double)i;
+        y[i] = 1.0 - (double)i;
+    }
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+            ret[i] = 2.0*x[i] + x[i]*y[i];
+        benchmark::DoNotOptimize(ret[n / 2]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)n);
+}
+BENCHMARK(BM_HandWrittenLoop)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
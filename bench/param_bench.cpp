@@ -0,0 +1,123 @@
+// call overhead of passing read-only parameters by value, by const reference
+// and as read_only_param_t<T> (11th Study), for small and large types
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "read-only-param.hpp"
+
+// calls must stay calls: noipa also keeps GCC from rewriting the parameter
+// passing of the (local) functions on its own
+#if defined(__GNUC__) && !defined(__clang__)
+#define BENCH_NOINLINE __attribute__((noipa))
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+struct Pair   // 16 bytes: two registers
+{
+    double x, y;
+};
+
+struct Triple // 24 bytes: in memory either way
+{
+    double x, y, z;
+};
+
+struct Big    // 64 bytes
+{
+    double v[8];
+};
+
+static double weight(int v) { return v; }
+static double weight(double v) { return v; }
+static double weight(Pair const &p) { return p.x + p.y; }
+static double weight(Triple const &t) { return t.x + t.y + t.z; }
+static double weight(Big const &b) { return b.v[0] + b.v[7]; }
+static double weight(std::string const &s) { return (double)s.size(); }
+
+static_assert(std::is_same_v<read_only_param_t<int>, int>);
+static_assert(std::is_same_v<read_only_param_t<Pair>, Pair>);
+static_assert(std::is_same_v<read_only_param_t<Triple>, Triple const &>);
+static_assert(std::is_same_v<read_only_param_t<std::string>, std::string const &>);
+
+template <typename T>
+BENCH_NOINLINE double byValue(T v) { return weight(v); }
+template <typename T>
+BENCH_NOINLINE double byConstRef(T const &v) { return weight(v); }
+template <typename T>
+BENCH_NOINLINE double byReadOnlyParam(read_only_param_t<T> v) { return weight(v); }
+
+// a value built from x in registers: each call depends on the result of the
+// previous one, so spilling the argument to memory for a reference (store,
+// then load in the callee) adds its latency to every call
+template <typename T>
+static T make(double x)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+        return std::string(static_cast<std::size_t>(x) % 64, 'x');
+    else if constexpr (std::is_arithmetic_v<T>)
+        return static_cast<T>(x);
+    else if constexpr (std::is_same_v<T, Big>)
+    {
+        Big b{};
+        b.v[0] = x;
+        return b;
+    }
+    else
+    {
+        T t{};
+        t.x = x;
+        return t;
+    }
+}
+
+constexpr std::size_t count = 1024;
+
+// Chain: arguments computed right before the call (in registers)
+// Stored: arguments read from a vector (already in memory)
+#define PARAM_BENCH(Name, Call)                                           \
+    template <typename T>                                                 \
+    static void Name##Chain(benchmark::State &state)                      \
+    {                                                                     \
+        for (auto _ : state)                                              \
+        {                                                                 \
+            double x = 1;                                                 \
+            for (std::size_t i = 0; i < count; ++i)                       \
+                x = Call(make<T>(x)) * 0.5 + 1;                           \
+            benchmark::DoNotOptimize(x);                                  \
+        }                                                                 \
+        state.SetItemsProcessed(state.iterations() * (int64_t)count);     \
+    }                                                                     \
+    template <typename T>                                                 \
+    static void Name##Stored(benchmark::State &state)                     \
+    {                                                                     \
+        std::vector<T> values;                                            \
+        for (std::size_t i = 0; i < count; ++i)                           \
+            values.push_back(make<T>((double)i));                         \
+        for (auto _ : state)                                              \
+        {                                                                 \
+            double sum = 0;                                               \
+            for (auto const &v : values)                                  \
+                sum += Call(v);                                           \
+            benchmark::DoNotOptimize(sum);                                \
+        }                                                                 \
+        state.SetItemsProcessed(state.iterations() * (int64_t)count);     \
+    }                                                                     \
+    BENCHMARK_TEMPLATE(Name##Chain, int);                                 \
+    BENCHMARK_TEMPLATE(Name##Chain, double);                              \
+    BENCHMARK_TEMPLATE(Name##Chain, Pair);                                \
+    BENCHMARK_TEMPLATE(Name##Chain, Triple);                              \
+    BENCHMARK_TEMPLATE(Name##Chain, Big);                                 \
+    BENCHMARK_TEMPLATE(Name##Stored, int);                                \
+    BENCHMARK_TEMPLATE(Name##Stored, Pair);                               \
+    BENCHMARK_TEMPLATE(Name##Stored, Big);                                \
+    BENCHMARK_TEMPLATE(Name##Stored, std::string)
+
+PARAM_BENCH(BM_ByValue, byValue<T>);
+PARAM_BENCH(BM_ByConstRef, byConstRef<T>);
+PARAM_BENCH(BM_ReadOnlyParam, byReadOnlyParam<T>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+// pretty_print of a 1M-element vector<int> (17th Study): the to_string()
+// of the Concepts TS version against write_pretty() into output iterators
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "pretty_print.hpp"
+
+// the Concepts TS version: one std::string temporary per element
+static std::string to_string(std::vector<int> v)
+{
+    std::string s = "";
+
+    for (int a : v)
+    {
+        s += (" " + std::to_string(a) + " ");
+    }
+
+    return s;
+}
+
+// swallows everything written to std::cout during a benchmark
+class NullBuffer : public std::streambuf
+{
+protected:
+    int overflow(int c) override
+    {
+        return c;
+    }
+    std::streamsize xsputn(const char *, std::streamsize n) override
+    {
+        return n;
+    }
+};
+
+class CoutToNull
+{
+private:
+    NullBuffer null_;
+    std::streambuf *saved_;
+
+public:
+    CoutToNull()
+        : saved_(std::cout.rdbuf(&null_)) {};
+    ~CoutToNull()
+    {
+        std::cout.rdbuf(saved_);
+    };
+};
+
+static std::vector<int> values()
+{
+    std::vector<int> v(1'000'000);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = (int)(i * 2654435761u % 2000001) - 1000000;
+    return v;
+}
+
+static void BM_ToString(benchmark::State &state)
+{
+    auto v = values();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(to_string(v).size());
+    state.SetItemsProcessed(state.iterations() * (int64_t)v.size());
+}
+BENCHMARK(BM_ToString)->Unit(benchmark::kMillisecond);
+
+static void BM_WritePrettyString(benchmark::State &state)
+{
+    auto v = values();
+    std::string buffer;
+    for (auto _ : state)
+    {
+        buffer.clear();  // keeps its capacity
+        write_pretty(std::back_inserter(buffer), v);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)v.size());
+}
+BENCHMARK(BM_WritePrettyString)->Unit(benchmark::kMillisecond);
+
+static void BM_WritePrettyCharBuffer(benchmark::State &state)
+{
+    auto v = values();
+    std::vector<char> buffer(v.size() * 16);  // " -1000000 " fits
+    for (auto _ : state)
+        benchmark::DoNotOptimize(write_pretty(buffer.data(), v));
+    state.SetItemsProcessed(state.iterations() * (int64_t)v.size());
+}
+BENCHMARK(BM_WritePrettyCharBuffer)->Unit(benchmark::kMillisecond);
+
+// whole calls including the stream, as in Concepts.cpp
+static void BM_PrettyPrintBefore(benchmark::State &state)
+{
+    auto v = values();
+    CoutToNull redirect;
+    for (auto _ : state)
+        std::cout << to_string(v) << std::endl;
+    state.SetItemsProcessed(state.iterations() * (int64_t)v.size());
+}
+BENCHMARK(BM_PrettyPrintBefore)->Unit(benchmark::kMillisecond);
+
+static void BM_PrettyPrintAfter(benchmark::State &state)
+{
+    auto v = values();
+    CoutToNull redirect;
+    for (auto _ : state)
+        pretty_print(v);
+    state.SetItemsProcessed(state.iterations() * (int64_t)v.size());
+}
+BENCHMARK(BM_PrettyPrintAfter)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,70 @@
+// fixed-capacity and small-buffer Stacks of the 2nd Study against std::stack
+#include <benchmark/benchmark.h>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <stack>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../11th Study/policy-traits/read-only-param.hpp"
+
+// every header defines its own class template Stack, so each one gets a
+// namespace (the headers they need are already included above)
+namespace nontype {
+#include "stacknontype.hpp"
+}
+namespace autosize {
+#include "stackauto.hpp"
+}
+namespace sbo {
+#include "stacksbo.hpp"
+}
+
+constexpr std::size_t capacity = 1024;
+
+template <typename S, typename T>
+static void pushPop(benchmark::State &state, T const &value)
+{
+    for (auto _ : state)
+    {
+        S s;
+        for (std::size_t i = 0; i < capacity; ++i)
+            s.push(value);
+        while (!s.empty())
+        {
+            benchmark::DoNotOptimize(s.top());
+            s.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (int64_t)capacity);
+}
+
+template <typename S>
+static void BM_PushPopInt(benchmark::State &state)
+{
+    pushPop<S>(state, 42);
+}
+BENCHMARK_TEMPLATE(BM_PushPopInt, nontype::Stack<int, capacity>);
+BENCHMARK_TEMPLATE(BM_PushPopInt, autosize::Stack<int, capacity>);
+BENCHMARK_TEMPLATE(BM_PushPopInt, sbo::Stack<int, capacity>);
+BENCHMARK_TEMPLATE(BM_PushPopInt, sbo::Stack<int, 16>);  // spills to the heap
+BENCHMARK_TEMPLATE(BM_PushPopInt, std::stack<int>);
+BENCHMARK_TEMPLATE(BM_PushPopInt, std::stack<int, std::vector<int>>);
+
+template <typename S>
+static void BM_PushPopString(benchmark::State &state)
+{
+    pushPop<S>(state, std::string("a string beyond the SSO limit"));
+}
+BENCHMARK_TEMPLATE(BM_PushPopString, nontype::Stack<std::string, capacity>);
+BENCHMARK_TEMPLATE(BM_PushPopString, sbo::Stack<std::string, 16>);
+BENCHMARK_TEMPLATE(BM_PushPopString, std::stack<std::string>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+// Variant::visit (16th Study) against std::variant with std::visit
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "Variant.hpp"
+
+template <typename V, typename Make>
+static std::vector<V> mixed(size_t n, Make make)
+{
+    std::vector<V> values;
+    values.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        values.push_back(make(i));
+    return values;
+}
+
+static void BM_VariantVisit(benchmark::State &state)
+{
+    using V = Variant<char, short, int, long long>;
+    auto values = mixed<V>((size_t)state.range(0), [](size_t i) {
+        switch (i % 4)
+        {
+        case 0: return V((char)i);
+        case 1: return V((short)i);
+        case 2: return V((int)i);
+        default: return V((long long)i);
+        }
+    });
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (auto const &v : values)
+            v.visit([&sum](auto const &val) { sum += val; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VariantVisit)->Range(1 << 10, 1 << 16);
+
+static void BM_StdVisit(benchmark::State &state)
+{
+    using V = std::variant<char, short, int, long long>;
+    auto values = mixed<V>((size_t)state.range(0), [](size_t i) {
+        switch (i % 4)
+        {
+        case 0: return V((char)i);
+        case 1: return V((short)i);
+        case 2: return V((int)i);
+        default: return V((long long)i);
+        }
+    });
+    for (auto _ : state)
+    {
+        long long sum = 0;
+        for (auto const &v : values)
+            std::visit([&sum](auto const &val) { sum += val; }, v);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdVisit)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_MAIN();